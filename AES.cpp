@@ -32,10 +32,13 @@
 // code to implement Advanced Encryption Standard - Rijndael
 // speed optimized version
 #include "AES.h"
+#include "AESNI.h"
+#include "AESBitslice.h"
 #include <algorithm>
 #include <stdio.h>
 #include <string.h>
 #include <stdint.h>
+#include <mutex>
 
 // todo - make faster 128 blocksize version with 128 blocksize hardcoded as necessary
 
@@ -51,40 +54,6 @@ using namespace std;
 
 namespace { // anonymous namespace for local linkage
 
-// tables for inverses, byte sub
-unsigned char gf2_8_inv[256];
-unsigned char byte_sub[256];
-unsigned char inv_byte_sub[256];
-
-// this table needs Nb*(Nr+1)/Nk entries - up to 8*(15)/4 = 60
-// todo - remove table, note cycles every 17(?) elements
-uint32_t Rcon[60];
-
-// long tables for encryption stuff
-uint32_t T0[256];
-uint32_t T1[256];
-uint32_t T2[256];
-uint32_t T3[256];
-
-// long tables for decryption stuff
-uint32_t I0[256];
-uint32_t I1[256];
-uint32_t I2[256];
-uint32_t I3[256];
-
-// huge tables - todo - ifdef out
-uint32_t T4[256];
-uint32_t T5[256];
-uint32_t T6[256];
-uint32_t T7[256];
-uint32_t I4[256];
-uint32_t I5[256];
-uint32_t I6[256];
-uint32_t I7[256];
-
-// have the tables been initialized?
-bool tablesInitialized = false;
-
 // define to mult a byte by x mod the proper poly
 // todo - move magic numbers out?
 #define xmult(a) ((a)<<1) ^ (((a)&128) ? 0x01B : 0)
@@ -109,7 +78,7 @@ bool tablesInitialized = false;
 #define RotByteL(a) ROTL8(a)
 
 // mult 2 elements using gf2_8_poly as a reduction
-inline unsigned char GF2_8_mult(unsigned char a, unsigned char b)
+constexpr unsigned char GF2_8_mult(unsigned char a, unsigned char b)
 	{ // todo - make 4x4 table for nibbles, use lookup
 	unsigned char result = 0;
 
@@ -133,175 +102,151 @@ inline unsigned char GF2_8_mult(unsigned char a, unsigned char b)
 	return result;
 	} // GF2_8_mult
 
-bool CheckLargeTables(bool create)
-	{
-	uint32_t i;
-	unsigned char a1,a2,a3,b1,b2,b3,b4,b5;
-	for (i = 0; i < 256; i++)
-		{
-		a1 = byte_sub[i];
-		a2 = xmult(a1);
-		a3 = a2^a1;
-
-		b5 = inv_byte_sub[i];
-		b1 = GF2_8_mult(0x0E,b5);
-		b2 = GF2_8_mult(0x09,b5);
-		b3 = GF2_8_mult(0x0D,b5);
-		b4 = GF2_8_mult(0x0B,b5);
-
-		if (create == true)
-			{
-			T0[i] = VEC4(a2,a1,a1,a3);
-			T1[i] = RotByteL(T0[i]);
-			T2[i] = RotByteL(T1[i]);
-			T3[i] = RotByteL(T2[i]);
-
-			T4[i] = VEC4(a1,0,0,0); // identity
-			T5[i] = RotByteL(T4[i]);
-			T6[i] = RotByteL(T5[i]);
-			T7[i] = RotByteL(T6[i]);
-
-			I0[i] = VEC4(b1,b2,b3,b4);
-			I1[i] = RotByteL(I0[i]);
-			I2[i] = RotByteL(I1[i]);
-			I3[i] = RotByteL(I2[i]);
-
-			I4[i] = VEC4(b5,0,0,0); // identity
-			I5[i] = RotByteL(I4[i]);
-			I6[i] = RotByteL(I5[i]);
-			I7[i] = RotByteL(I6[i]);
-			}
-		else
-			{
-			if (T0[i] != VEC4(a2,a1,a1,a3))
-				return false;
-			if (T1[i] != RotByteL(T0[i]))
-				return false;
-			if (T2[i] != RotByteL(T1[i]))
-				return false;
-			if (T3[i] != RotByteL(T2[i]))
-				return false;
-			if (T4[i] != VEC4(a1,0,0,0))
-				return false;
-			if (T5[i] != RotByteL(T4[i]))
-				return false;
-			if (T6[i] != RotByteL(T5[i]))
-				return false;
-			if (T7[i] != RotByteL(T6[i]))
-				return false;
-			if (I0[i] != VEC4(b1,b2,b3,b4))
-				return false;
-			if (I1[i] != RotByte(I0[i]))
-				return false;
-			if (I2[i] != RotByte(I1[i]))
-				return false;
-			if (I3[i] != RotByte(I2[i]))
-				return false;
-			if (I4[i] != VEC4(b5,0,0,0))
-				return false;
-			if (I5[i] != RotByteL(I4[i]))
-				return false;
-			if (I6[i] != RotByteL(I5[i]))
-				return false;
-			if (I7[i] != RotByteL(I6[i]))
-				return false;
-			}
-		}
-	return true;
-	} // CheckLargeTables
-
-// some functions to create/verify table integrity
-bool CheckInverses(bool create)
-	{
-	uint32_t a, b;
-	//unsigned int a,b; // need int here to prevent wraps in loop
-	if (create == true)
-		gf2_8_inv[0] = 0;
-	else if (gf2_8_inv[0] != 0)
-		return false;
-	for (a = 1; a <= 255; a++)
-		{
-		b = 1;
-		while (GF2_8_mult(a,b) != 1)
-			b++;
-
-		if (create == true)
-			gf2_8_inv[a] = b;
-		else if (gf2_8_inv[a] != b)
-			return false;
-		}
-	return true;
-	} // CheckInverses
-
-unsigned char BitSum(unsigned char byte)
+constexpr unsigned char BitSum(unsigned char byte)
 	{ // return the sum of bits mod 2
 	byte = (byte>>4)^(byte&15);
 	byte = (byte>>2)^(byte&3);
 	return (byte>>1)^(byte&1);
 	} // BitSum
 
-bool CheckByteSub(bool create)
-	{
-	if (CheckInverses(create) == false)
-		return false; // we cannot do this without inverses
-	uint32_t x, y;
-	//unsigned int x,y; // need ints here to prevent wrap in loop
-	for (x = 0; x <= 255; x++)
-		{
-		y = gf2_8_inv[x]; // inverse to start with
+constexpr uint32_t RotWordL(uint32_t a)
+	{ // ROTL8 on a 32 bit word
+	return (a<<8)|(a>>24);
+	} // RotWordL
 
-		// affine transform
-		y = BitSum(y&0xF1) | (BitSum(y&0xE3)<<1) | (BitSum(y&0xC7)<<2) | (BitSum(y&0x8F)<<3) |
-			(BitSum(y&0x1F)<<4) | (BitSum(y&0x3E)<<5) | (BitSum(y&0x7C)<<6) | (BitSum(y&0xF8)<<7);
-		y = y ^ 0x63;
-		if (create == true)
-			byte_sub[x] = y;
-		else if (byte_sub[x] != y)
-			return false;
-		}
-	return true;
-	} // CheckByteSub
-
-bool CheckInvByteSub(bool create)
+// all tables are computed by the compiler, so they are read only data that
+// is shared between processes and nothing has to be built at startup
+struct AESTables
 	{
-	if (CheckInverses(create) == false)
-		return false; // we cannot do this without inverses
-	if (CheckByteSub(create) == false)
-		return false; // we cannot do this without byte_sub
-	uint32_t x, y;
-	//unsigned int x,y; // need ints here to prevent wrap in loop
-	for (x = 0; x <= 255; x++)
+	// long tables for encryption stuff
+	uint32_t T0[256];
+	uint32_t T1[256];
+	uint32_t T2[256];
+	uint32_t T3[256];
+
+	// long tables for decryption stuff
+	uint32_t I0[256];
+	uint32_t I1[256];
+	uint32_t I2[256];
+	uint32_t I3[256];
+
+	// huge tables - todo - ifdef out
+	uint32_t T4[256];
+	uint32_t T5[256];
+	uint32_t T6[256];
+	uint32_t T7[256];
+	uint32_t I4[256];
+	uint32_t I5[256];
+	uint32_t I6[256];
+	uint32_t I7[256];
+
+	// tables for inverses, byte sub
+	unsigned char gf2_8_inv[256];
+	unsigned char byte_sub[256];
+	unsigned char inv_byte_sub[256];
+
+	// this table needs Nb*(Nr+1)/Nk entries - up to 8*(15)/4 = 60
+	// todo - remove table, note cycles every 17(?) elements
+	uint32_t Rcon[60];
+
+	constexpr AESTables() : T0(), T1(), T2(), T3(), I0(), I1(), I2(), I3(),
+		T4(), T5(), T6(), T7(), I4(), I5(), I6(), I7(),
+		gf2_8_inv(), byte_sub(), inv_byte_sub(), Rcon()
 		{
-		// we brute force it...
-		y = 0;
-		while (byte_sub[y] != x)
-			y++;
-		if (create == true)
-			inv_byte_sub[x] = y;
-		else if (inv_byte_sub[x] != y)
-			return false;
-		}
-	return true;
-	} // CheckInvByteSub
+		// inverses from the powers of the generator 0x03: inv(3^i) = 3^(255-i)
+		unsigned char power[255] = {};
+		unsigned char a = 1;
+		for (int i = 0; i < 255; i++)
+			{
+			power[i] = a;
+			a = GF2_8_mult(a,0x03);
+			}
+		gf2_8_inv[0] = 0;
+		for (int i = 0; i < 255; i++)
+			gf2_8_inv[power[i]] = power[(255-i)%255];
 
-bool CheckRcon(bool create)
-	{
-	unsigned char Ri = 1; // start here
+		for (int x = 0; x <= 255; x++)
+			{
+			unsigned char y = gf2_8_inv[x]; // inverse to start with
+
+			// affine transform
+			y = BitSum(y&0xF1) | (BitSum(y&0xE3)<<1) | (BitSum(y&0xC7)<<2) | (BitSum(y&0x8F)<<3) |
+				(BitSum(y&0x1F)<<4) | (BitSum(y&0x3E)<<5) | (BitSum(y&0x7C)<<6) | (BitSum(y&0xF8)<<7);
+			y = y ^ 0x63;
+			byte_sub[x] = y;
+			inv_byte_sub[y] = x;
+			}
 
-	if (create == true)
+		unsigned char Ri = 1; // start here
 		Rcon[0] = 0;
-	else if (Rcon[0] != 0)
-		return false; // todo - this is unused still check?
-	for (unsigned int i = 1; i < sizeof(Rcon)/sizeof(Rcon[0])-1; i++)
-		{
-		if (create == true)
+		for (unsigned int i = 1; i < sizeof(Rcon)/sizeof(Rcon[0])-1; i++)
+			{
 			Rcon[i] = Ri;
-		else if (Rcon[i] != Ri)
-			return false;
-		Ri = GF2_8_mult(Ri,0x02); // multiply by x - todo replace with xmult
+			Ri = GF2_8_mult(Ri,0x02); // multiply by x
+			}
+
+		for (int i = 0; i < 256; i++)
+			{
+			uint32_t a1 = byte_sub[i];
+			uint32_t a2 = GF2_8_mult(a1,0x02);
+			uint32_t a3 = a2^a1;
+
+			uint32_t b5 = inv_byte_sub[i];
+			uint32_t b1 = GF2_8_mult(0x0E,b5);
+			uint32_t b2 = GF2_8_mult(0x09,b5);
+			uint32_t b3 = GF2_8_mult(0x0D,b5);
+			uint32_t b4 = GF2_8_mult(0x0B,b5);
+
+			T0[i] = a2 | (a1<<8) | (a1<<16) | (a3<<24);
+			T1[i] = RotWordL(T0[i]);
+			T2[i] = RotWordL(T1[i]);
+			T3[i] = RotWordL(T2[i]);
+
+			T4[i] = a1; // identity
+			T5[i] = RotWordL(T4[i]);
+			T6[i] = RotWordL(T5[i]);
+			T7[i] = RotWordL(T6[i]);
+
+			I0[i] = b1 | (b2<<8) | (b3<<16) | (b4<<24);
+			I1[i] = RotWordL(I0[i]);
+			I2[i] = RotWordL(I1[i]);
+			I3[i] = RotWordL(I2[i]);
+
+			I4[i] = b5; // identity
+			I5[i] = RotWordL(I4[i]);
+			I6[i] = RotWordL(I5[i]);
+			I7[i] = RotWordL(I6[i]);
+			}
 		}
-	return true;
-	} // CheckRCon
+	};
+
+alignas(64) constexpr AESTables tables;
+
+// some known values from FIPS-197 - checked by the compiler
+static_assert(tables.byte_sub[0x00] == 0x63, "S-box broken");
+static_assert(tables.byte_sub[0x53] == 0xED, "S-box broken");
+static_assert(tables.inv_byte_sub[0x63] == 0x00, "inverse S-box broken");
+static_assert(tables.Rcon[10] == 0x36, "Rcon broken");
+
+// short names used by the round macros
+constexpr const uint32_t (&T0)[256] = tables.T0;
+constexpr const uint32_t (&T1)[256] = tables.T1;
+constexpr const uint32_t (&T2)[256] = tables.T2;
+constexpr const uint32_t (&T3)[256] = tables.T3;
+constexpr const uint32_t (&T4)[256] = tables.T4;
+constexpr const uint32_t (&T5)[256] = tables.T5;
+constexpr const uint32_t (&T6)[256] = tables.T6;
+constexpr const uint32_t (&T7)[256] = tables.T7;
+constexpr const uint32_t (&I0)[256] = tables.I0;
+constexpr const uint32_t (&I1)[256] = tables.I1;
+constexpr const uint32_t (&I2)[256] = tables.I2;
+constexpr const uint32_t (&I3)[256] = tables.I3;
+constexpr const uint32_t (&I4)[256] = tables.I4;
+constexpr const uint32_t (&I5)[256] = tables.I5;
+constexpr const uint32_t (&I6)[256] = tables.I6;
+constexpr const uint32_t (&I7)[256] = tables.I7;
+constexpr const unsigned char (&byte_sub)[256] = tables.byte_sub;
+constexpr const uint32_t (&Rcon)[60] = tables.Rcon;
 
 // key adding for 4,6,8 column cases
 #define AddRoundKey4(dest,src)	\
@@ -473,22 +418,71 @@ unsigned long SubByte(unsigned long data)
 	return result;
 	} // SubByte
 
-// return true iff tables are valid. create = true fills them in if not
-bool CreateAESTables(bool create)
+
+// cache of expanded keys
+// reconnecting with the same key takes the finished schedule from here instead of
+// repeating KeyExpansion (and the InvMixColumns pass for decryption). Entries are
+// found by a digest of the key and then compared with the key itself.
+struct KeyCacheEntry
 	{
-	bool retval = true;
-	if (CheckInverses(create) == false)
-		retval = false;
-	if (CheckByteSub(create) == false)
-		retval = false;
-	if (CheckInvByteSub(create) == false)
-		retval = false;
-	if (CheckRcon(create) == false)
-		return false;
-	if (CheckLargeTables(create) == false)
-		return false;
-	return retval;
-	} // CreateAESTables
+	uint64_t digest;          // 0 = unused
+	int32_t Nk, Nb;
+	bool decrypt;             // schedule of StartDecryption or StartEncryption
+	uint32_t lastUse;         // for replacing the least recently used entry
+	unsigned char key[32];
+	unsigned char W[4*8*15];
+	};
+
+const int KEY_CACHE_ENTRIES = 16;
+KeyCacheEntry keyCache[KEY_CACHE_ENTRIES];
+uint32_t keyCacheClock = 0;
+mutex keyCacheMutex;
+
+uint64_t KeyDigest(const unsigned char * key, int32_t Nk, int32_t Nb, bool decrypt)
+	{ // FNV-1a over key and parameters, only used to find an entry
+	uint64_t h = 14695981039346656037ULL;
+	for (int i = 0; i < 4*Nk; i++)
+		h = (h ^ key[i]) * 1099511628211ULL;
+	h = (h ^ (uint64_t)(Nk | (Nb<<8) | (decrypt<<16))) * 1099511628211ULL;
+	return h ? h : 1;
+	} // KeyDigest
+
+// copy the cached schedule to W, returns false if the key is not in the cache
+bool KeyCacheGet(const unsigned char * key, int32_t Nk, int32_t Nb, bool decrypt, unsigned char * W, size_t size)
+	{
+	uint64_t digest = KeyDigest(key, Nk, Nb, decrypt);
+	lock_guard<mutex> lock(keyCacheMutex);
+	for (int i = 0; i < KEY_CACHE_ENTRIES; i++)
+		{
+		KeyCacheEntry & e = keyCache[i];
+		if ((e.digest == digest) && (e.Nk == Nk) && (e.Nb == Nb) && (e.decrypt == decrypt) &&
+			(memcmp(e.key, key, 4*Nk) == 0))
+			{
+			memcpy(W, e.W, size);
+			e.lastUse = ++keyCacheClock;
+			return true;
+			}
+		}
+	return false;
+	} // KeyCacheGet
+
+void KeyCachePut(const unsigned char * key, int32_t Nk, int32_t Nb, bool decrypt, const unsigned char * W, size_t size)
+	{
+	uint64_t digest = KeyDigest(key, Nk, Nb, decrypt);
+	lock_guard<mutex> lock(keyCacheMutex);
+	int slot = 0;
+	for (int i = 1; i < KEY_CACHE_ENTRIES; i++)
+		if (keyCache[i].lastUse < keyCache[slot].lastUse)
+			slot = i;
+	KeyCacheEntry & e = keyCache[slot];
+	e.digest = digest;
+	e.Nk = Nk;
+	e.Nb = Nb;
+	e.decrypt = decrypt;
+	e.lastUse = ++keyCacheClock;
+	memcpy(e.key, key, 4*Nk);
+	memcpy(e.W, W, size);
+	} // KeyCachePut
 
 }// end of anonymous namespace
 
@@ -557,7 +551,10 @@ void AES::SetIV(const unsigned char * ucIV, unsigned int iIVsize)
 void AES::StartEncryption(const unsigned char * key)
 	{
 	memset(iv, 0xff, sizeof(iv));
+	if (KeyCacheGet(key, Nk, Nb, false, W, sizeof(W)))
+		return;
 	KeyExpansion(key);
+	KeyCachePut(key, Nk, Nb, false, W, sizeof(W));
 	} // StartEncryption
 
 void AES::EncryptBlock(const unsigned char * datain1, unsigned char * dataout1)
@@ -565,6 +562,17 @@ void AES::EncryptBlock(const unsigned char * datain1, unsigned char * dataout1)
 	  // todo - clean up - lots of repeated macros
 	  // we only encrypt one block from now on
 
+	if ((Nb == 8) && (backend == AESNI))
+		{
+		AESNI_EncryptBlock256(W, Nr, datain1, dataout1);
+		return;
+		}
+	if ((Nb == 8) && (backend == BITSLICE))
+		{
+		AESBitslice_EncryptECB256(W, Nr, datain1, dataout1, 1);
+		return;
+		}
+
 	uint32_t state[8*2]; // 2 buffers
 	uint32_t * r_ptr = reinterpret_cast<uint32_t*>(W);
 	uint32_t * dest  = state;
@@ -654,6 +662,14 @@ void AES::Encrypt(const unsigned char * datain, unsigned char * dataout, uint32_
 	if (0 == numBlocks)
 		return;
 	uint32_t blocksize = Nb*4;
+	if ((Nb == 8) && (backend == BITSLICE))
+		{ // 8 blocks per pass, CBC only uses one lane
+		if (mode == ECB)
+			AESBitslice_EncryptECB256(W, Nr, datain, dataout, numBlocks);
+		else if (mode == CBC)
+			AESBitslice_EncryptCBC256(W, Nr, iv, datain, dataout, numBlocks);
+		return;
+		}
 	switch (mode)
 		{
 		case ECB :
@@ -688,6 +704,8 @@ void AES::Encrypt(const unsigned char * datain, unsigned char * dataout, uint32_
 void AES::StartDecryption(const unsigned char * key)
 	{
 	memset(iv, 0xff, sizeof(iv));
+	if (KeyCacheGet(key, Nk, Nb, true, W, sizeof(W)))
+		return;
 	KeyExpansion(key);
 
 	unsigned char a0,a1,a2,a3,b0,b1,b2,b3, * W_ptr = W;
@@ -719,10 +737,29 @@ void AES::StartDecryption(const unsigned char * key)
 	for (int pos = 0; pos < Nr/2; pos++)
 		for (int col = 0; col < Nb; col++)
 			swap(WL[col+pos*Nb],WL[col+(Nr-pos)*Nb]);
+
+	KeyCachePut(key, Nk, Nb, true, W, sizeof(W));
 	} // StartDecryption
 
+void AES::ClearKeyCache(void)
+	{
+	lock_guard<mutex> lock(keyCacheMutex);
+	memset(keyCache, 0, sizeof(keyCache));
+	} // ClearKeyCache
+
 void AES::DecryptBlock(const unsigned char * datain1, unsigned char * dataout1)
 	{
+	if ((Nb == 8) && (backend == AESNI))
+		{
+		AESNI_DecryptBlock256(W, Nr, datain1, dataout1);
+		return;
+		}
+	if ((Nb == 8) && (backend == BITSLICE))
+		{
+		AESBitslice_DecryptECB256(W, Nr, datain1, dataout1, 1);
+		return;
+		}
+
 	uint32_t state[8*2]; // 2 buffers
 	uint32_t * r_ptr = reinterpret_cast<uint32_t *>(W);
 	uint32_t * dest  = state;
@@ -812,6 +849,14 @@ void AES::Decrypt(const unsigned char * datain, unsigned char * dataout, uint32_
 	if (0 == numBlocks)
 		return;
 	uint32_t blocksize = Nb*4;
+	if ((Nb == 8) && (backend == BITSLICE))
+		{ // 8 blocks per pass
+		if (mode == ECB)
+			AESBitslice_DecryptECB256(W, Nr, datain, dataout, numBlocks);
+		else if (mode == CBC)
+			AESBitslice_DecryptCBC256(W, Nr, iv, datain, dataout, numBlocks);
+		return;
+		}
 	switch (mode)
 		{
 		case ECB :
@@ -824,6 +869,11 @@ void AES::Decrypt(const unsigned char * datain, unsigned char * dataout, uint32_
 				}
 			break;
 		case CBC :
+			if ((Nb == 8) && (backend == AESNI))
+				{ // blocks are decrypted interleaved
+				AESNI_DecryptCBC256(W, Nr, iv, datain, dataout, numBlocks);
+				break;
+				}
 			{
 			int iBuf = 0;
 			unsigned char buffer[2][32]; // max blocksize
@@ -851,11 +901,82 @@ void AES::Decrypt(const unsigned char * datain, unsigned char * dataout, uint32_
 		}
 	} // Decrypt
 
+void AES::EncryptStreams(AES * const * streams, const unsigned char * const * datain,
+	unsigned char * const * dataout, const uint32_t * numBlocks, uint32_t numStreams)
+	{
+	if (0 == numStreams)
+		return;
+	const AES & first = *streams[0];
+	bool parallel = (first.Nb == 8) && (first.backend != TABLE);
+	for (uint32_t s = 1; parallel && (s < numStreams); s++)
+		parallel = (streams[s]->Nb == 8) && (streams[s]->Nr == first.Nr) && (streams[s]->backend == first.backend);
+
+	if (parallel == false)
+		{
+		for (uint32_t s = 0; s < numStreams; s++)
+			streams[s]->Encrypt(datain[s], dataout[s], numBlocks[s], CBC);
+		return;
+		}
+
+	// key schedules and IVs of a group of streams, no memory is allocated
+	const uint32_t groupSize = 8;
+	const unsigned char * W[groupSize];
+	const unsigned char * iv[groupSize];
+	for (uint32_t group = 0; group < numStreams; group += groupSize)
+		{
+		const uint32_t n = (numStreams - group < groupSize) ? (numStreams - group) : groupSize;
+		for (uint32_t s = 0; s < n; s++)
+			{
+			W[s] = streams[group + s]->W;
+			iv[s] = streams[group + s]->iv;
+			}
+		if (first.backend == AESNI)
+			AESNI_EncryptCBC256Streams(W, first.Nr, iv, datain + group, dataout + group, numBlocks + group, n);
+		else
+			AESBitslice_EncryptCBC256Streams(W, first.Nr, iv, datain + group, dataout + group, numBlocks + group, n);
+		}
+	} // EncryptStreams
+
+void AES::DecryptStreams(AES * const * streams, const unsigned char * const * datain,
+	unsigned char * const * dataout, const uint32_t * numBlocks, uint32_t numStreams)
+	{
+	// the blocks of one stream do not depend on each other, so the backends already
+	// decrypt 4 (AESNI) or 8 (BITSLICE) blocks of a stream at once
+	for (uint32_t s = 0; s < numStreams; s++)
+		streams[s]->Decrypt(datain[s], dataout[s], numBlocks[s], CBC);
+	} // DecryptStreams
+
+bool AES::BackendSupported(Backend b)
+	{
+	// the CPU is checked once; the initialization of a local static is thread safe
+	// and later calls only read the value
+	static const bool aesniSupported = AESNI_Supported();
+	static const bool bitsliceSupported = AESBitslice_Supported();
+
+	if (b == AESNI)
+		return aesniSupported;
+	if (b == BITSLICE)
+		return bitsliceSupported;
+	return (b == TABLE);
+	} // BackendSupported
+
+bool AES::SetBackend(Backend b)
+	{
+	if (BackendSupported(b) == false)
+		return false;
+	backend = b;
+	return true;
+	} // SetBackend
+
 // the constructor - makes sure local things are initialized
 AES::AES(void)
 	{
-	if (false == tablesInitialized)
-		tablesInitialized = CreateAESTables(true);
+	if (BackendSupported(AESNI))
+		backend = AESNI;
+	else if (BackendSupported(BITSLICE))
+		backend = BITSLICE; // constant time, no data dependent table lookups
+	else
+		backend = TABLE;
 	}
 
 // end - AES.cpp
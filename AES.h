@@ -54,6 +54,10 @@
    aes.SetParameters(192);
    aes.StartEncryption(key);
    aes.Encrypt(data,output,3); // note data and output must be at least 48 bytes!
+
+   An AES object only uses its own members and the constant tables, so it can be
+   copied like a value and different objects can be used on different threads at
+   the same time. One object must not be used by two threads at once.
   */
 
 #define ROUNDUP(x, y)				(((x) + (y-1)) & ~(y-1))
@@ -64,8 +68,7 @@
 class AES
 	{
 public:
-	// the constructor - makes sure local things are initialized
-	// it if fails, throws the string "Tables failed to initialize"
+	// the constructor - selects the backend, the tables are built at compile time
 	AES(void);
 
 	// multiple block encryption/decryption modes
@@ -80,12 +83,32 @@ public:
 		// todo - GCM = 6, - http://www.cryptobarn.com/papers/gcm-spec.pdf
 		};
 
+	// implementation used for the block functions
+	// the constructor selects the fastest one the CPU supports
+	enum Backend {
+		TABLE = 0,    // portable table lookup code, all block and key sizes
+		AESNI = 1,    // AES-NI instructions, only used for 256 bit blocks (others use TABLE)
+		BITSLICE = 2  // constant time bitsliced AVX2 code for CPUs without AES-NI,
+		              // 8 blocks at once, only used for 256 bit blocks
+		};
+
+	// select the implementation, returns false and keeps the current one if the CPU
+	// does not support it. Mostly useful for testing and benchmarking.
+	bool SetBackend(Backend b);
+	Backend GetBackend(void) const { return backend; }
+	static bool BackendSupported(Backend b);
+
+	// wipe all cached key schedules (e.g. before the process drops a key)
+	static void ClearKeyCache(void);
+
 	// block and key size are in bits, legal values are 128, 192, and 256 independently.
 	// NOTE: the AES standard only uses a blocksize of 128, so we default to that
 	void SetParameters(int keylength, int blocklength = 128);
 	void SetIV(const unsigned char * ucIV, unsigned int iIVsize);
 
 	// call this before any encryption with the key to use
+	// the expanded keys of the last used keys are cached for the whole process, so
+	// calling this again with the same key (e.g. on reconnect) only copies the schedule
 	void StartEncryption(const unsigned char * key);
 	// encrypt a single block (default 128 bits, or unsigned char[16]) of data
 	void EncryptBlock(const unsigned char * datain, unsigned char * dataout);
@@ -95,7 +118,7 @@ public:
 	// Decryption must use the same mode as the encryption.
 	void Encrypt(const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks, BlockMode mode = CBC);
 
-	// call this before any decryption with the key to use
+	// call this before any decryption with the key to use, cached like StartEncryption
 	void StartDecryption(const unsigned char * key);
 	// decrypt a single block (default 128 bits, or unsigned char[16]) of data
 	void DecryptBlock(const unsigned char * datain, unsigned char * dataout);
@@ -106,6 +129,18 @@ public:
 	// Encryption must use the same mode as the decryption.
 	void Decrypt(const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks, BlockMode mode = CBC);
 
+	// CBC encryption/decryption of numStreams independent streams, e.g. the frames for
+	// several S10s. Stream s uses the key and IV of streams[s] and numBlocks[s] blocks
+	// of datain[s] / dataout[s] (in place is allowed). Like Encrypt and Decrypt the IVs
+	// are not changed. If all streams use 256 bit blocks, the same number of rounds
+	// and a SIMD backend, the encryption runs one lane per stream (AES-NI: 4, VAES: 8
+	// streams interleaved, BITSLICE: 8 streams per pass); otherwise and for
+	// decryption, which is already parallel inside a stream, the streams run one by one.
+	static void EncryptStreams(AES * const * streams, const unsigned char * const * datain,
+		unsigned char * const * dataout, const uint32_t * numBlocks, uint32_t numStreams);
+	static void DecryptStreams(AES * const * streams, const unsigned char * const * datain,
+		unsigned char * const * dataout, const uint32_t * numBlocks, uint32_t numStreams);
+
 private:
 
 	int32_t Nb,Nk;    // block and key length / 32, should be 4,6,or 8
@@ -113,6 +148,7 @@ private:
 
 	unsigned char W[4*8*15];   // the expanded key
 	unsigned char iv[32];  	   // initial value which is incremented
+	Backend backend;           // implementation used for Nb == 8
 
 	// Key expansion code - makes local copy
 	void KeyExpansion(const unsigned char * key);
@@ -0,0 +1,595 @@
+//============================================================================
+// Name        : AESBitslice.cpp
+// Description : Bitsliced AVX2 implementation of the Rijndael cipher with
+//             : 256 bit blocks (Nb == 8) for CPUs without AES-NI.
+//
+// 8 blocks are processed at once. They are transposed into 8 bit planes of
+// 32 bytes each: bit b of byte p of plane i is bit i of byte p of block b.
+// SubBytes is then a boolean circuit on the planes (Boyar-Peralta), ShiftRows
+// a byte shuffle of every plane and MixColumns a rotation of the bytes inside
+// the columns plus xtime, which only renames and xors planes. There are no
+// table lookups and no branches on data or key, so the run time does not
+// depend on them.
+//============================================================================
+
+#include "AESBitslice.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define BITSLICE_TARGET __attribute__((target("avx2")))
+#define BITSLICE_INLINE __attribute__((target("avx2"), always_inline)) inline
+// the loops over the 8 planes have to be unrolled, otherwise the planes are kept in memory
+#define UNROLL8 _Pragma("GCC unroll 8")
+
+bool AESBitslice_Supported(void)
+	{
+	unsigned int eax, ebx, ecx, edx;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return false;
+	// ECX bit 27 = OSXSAVE, bit 28 = AVX
+	if (!(ecx & (1 << 27)) || !(ecx & (1 << 28)))
+		return false;
+	// the OS has to save the SSE and AVX state (XCR0 bits 1 and 2)
+	unsigned int xcr0, xcr0High;
+	__asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0High) : "c" (0));
+	if ((xcr0 & 6) != 6)
+		return false;
+	// leaf 7 EBX bit 5 = AVX2
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+		return false;
+	return (ebx & (1 << 5)) != 0;
+	}
+
+namespace {
+
+// byte shuffles of one plane, built at compile time
+struct BitsliceMasks
+	{
+	// ShiftRows rotates row r of the 8 columns by 0, 1, 3 and 4 columns. vpshufb
+	// only works inside 128 bit lanes, so each shuffle is split into the bytes
+	// from the same lane and the bytes from the other lane (0x80 = zero)
+	alignas(32) int8_t shiftSame[32];
+	alignas(32) int8_t shiftOther[32];
+	alignas(32) int8_t invShiftSame[32];
+	alignas(32) int8_t invShiftOther[32];
+	// rotation of the 4 bytes of each column by 1 and 2 rows
+	alignas(32) int8_t rot1[32];
+	alignas(32) int8_t rot2[32];
+
+	constexpr BitsliceMasks() : shiftSame(), shiftOther(), invShiftSame(), invShiftOther(), rot1(), rot2()
+		{
+		const int shift[4] = {0, 1, 3, 4};
+		for (int p = 0; p < 32; p++)
+			{
+			const int col = p / 4, row = p % 4;
+			const int src    = 4*((col + shift[row]) % 8) + row;
+			const int invSrc = 4*((col + 8 - shift[row]) % 8) + row;
+			const bool same    = (src / 16) == (p / 16);
+			const bool invSame = (invSrc / 16) == (p / 16);
+			shiftSame[p]     = same ? (src % 16) : -128;
+			shiftOther[p]    = same ? -128 : (src % 16);
+			invShiftSame[p]  = invSame ? (invSrc % 16) : -128;
+			invShiftOther[p] = invSame ? -128 : (invSrc % 16);
+			rot1[p] = 4*((p % 16) / 4) + (row + 1) % 4;
+			rot2[p] = 4*((p % 16) / 4) + (row + 2) % 4;
+			}
+		}
+	};
+
+constexpr BitsliceMasks masks;
+
+// bitsliced round keys of up to 15 rounds
+struct BitsliceKeys
+	{
+	__m256i rk[15][8];
+	};
+
+#define LOAD_MASK(m) _mm256_load_si256(reinterpret_cast<const __m256i*>(masks.m))
+
+// exchange the bits of a selected by mask << n with the bits of b selected by mask
+#define SWAPMOVE(a, b, mask, n) \
+		{ \
+		const __m256i t = _mm256_and_si256(_mm256_xor_si256(_mm256_srli_epi64(a, n), b), mask); \
+		b = _mm256_xor_si256(b, t); \
+		a = _mm256_xor_si256(a, _mm256_slli_epi64(t, n)); \
+		}
+
+#define XOR(a, b) _mm256_xor_si256(a, b)
+#define AND(a, b) _mm256_and_si256(a, b)
+
+// transpose the 8x8 bit matrices of every byte position: afterwards bit b of x[i]
+// is bit i of the former x[b]. The transposition is its own inverse.
+BITSLICE_INLINE void Transpose(__m256i x[8])
+	{
+	const __m256i m1 = _mm256_set1_epi8(0x55);
+	const __m256i m2 = _mm256_set1_epi8(0x33);
+	const __m256i m4 = _mm256_set1_epi8(0x0f);
+	SWAPMOVE(x[0], x[1], m1, 1);
+	SWAPMOVE(x[2], x[3], m1, 1);
+	SWAPMOVE(x[4], x[5], m1, 1);
+	SWAPMOVE(x[6], x[7], m1, 1);
+	SWAPMOVE(x[0], x[2], m2, 2);
+	SWAPMOVE(x[1], x[3], m2, 2);
+	SWAPMOVE(x[4], x[6], m2, 2);
+	SWAPMOVE(x[5], x[7], m2, 2);
+	SWAPMOVE(x[0], x[4], m4, 4);
+	SWAPMOVE(x[1], x[5], m4, 4);
+	SWAPMOVE(x[2], x[6], m4, 4);
+	SWAPMOVE(x[3], x[7], m4, 4);
+	}
+
+// S-box circuit of Boyar and Peralta (113 gates), U0/S0 is the most significant bit
+BITSLICE_INLINE void SubBytes(__m256i x[8])
+	{
+	const __m256i ones = _mm256_set1_epi8(-1);
+	const __m256i U0 = x[7], U1 = x[6], U2 = x[5], U3 = x[4];
+	const __m256i U4 = x[3], U5 = x[2], U6 = x[1], U7 = x[0];
+	// top linear layer
+	const __m256i T1 = XOR(U0, U3);
+	const __m256i T2 = XOR(U0, U5);
+	const __m256i T3 = XOR(U0, U6);
+	const __m256i T4 = XOR(U3, U5);
+	const __m256i T5 = XOR(U4, U6);
+	const __m256i T6 = XOR(T1, T5);
+	const __m256i T7 = XOR(U1, U2);
+	const __m256i T8 = XOR(U7, T6);
+	const __m256i T9 = XOR(U7, T7);
+	const __m256i T10 = XOR(T6, T7);
+	const __m256i T11 = XOR(U1, U5);
+	const __m256i T12 = XOR(U2, U5);
+	const __m256i T13 = XOR(T3, T4);
+	const __m256i T14 = XOR(T6, T11);
+	const __m256i T15 = XOR(T5, T11);
+	const __m256i T16 = XOR(T5, T12);
+	const __m256i T17 = XOR(T9, T16);
+	const __m256i T18 = XOR(U3, U7);
+	const __m256i T19 = XOR(T7, T18);
+	const __m256i T20 = XOR(T1, T19);
+	const __m256i T21 = XOR(U6, U7);
+	const __m256i T22 = XOR(T7, T21);
+	const __m256i T23 = XOR(T2, T22);
+	const __m256i T24 = XOR(T2, T10);
+	const __m256i T25 = XOR(T20, T17);
+	const __m256i T26 = XOR(T3, T16);
+	const __m256i T27 = XOR(T1, T12);
+	// inversion in GF(2^8)
+	const __m256i M1 = AND(T13, T6);
+	const __m256i M2 = AND(T23, T8);
+	const __m256i M3 = XOR(T14, M1);
+	const __m256i M4 = AND(T19, U7);
+	const __m256i M5 = XOR(M4, M1);
+	const __m256i M6 = AND(T3, T16);
+	const __m256i M7 = AND(T22, T9);
+	const __m256i M8 = XOR(T26, M6);
+	const __m256i M9 = AND(T20, T17);
+	const __m256i M10 = XOR(M9, M6);
+	const __m256i M11 = AND(T1, T15);
+	const __m256i M12 = AND(T4, T27);
+	const __m256i M13 = XOR(M12, M11);
+	const __m256i M14 = AND(T2, T10);
+	const __m256i M15 = XOR(M14, M11);
+	const __m256i M16 = XOR(M3, M2);
+	const __m256i M17 = XOR(M5, T24);
+	const __m256i M18 = XOR(M8, M7);
+	const __m256i M19 = XOR(M10, M15);
+	const __m256i M20 = XOR(M16, M13);
+	const __m256i M21 = XOR(M17, M15);
+	const __m256i M22 = XOR(M18, M13);
+	const __m256i M23 = XOR(M19, T25);
+	const __m256i M24 = XOR(M22, M23);
+	const __m256i M25 = AND(M22, M20);
+	const __m256i M26 = XOR(M21, M25);
+	const __m256i M27 = XOR(M20, M21);
+	const __m256i M28 = XOR(M23, M25);
+	const __m256i M29 = AND(M28, M27);
+	const __m256i M30 = AND(M26, M24);
+	const __m256i M31 = AND(M20, M23);
+	const __m256i M32 = AND(M27, M31);
+	const __m256i M33 = XOR(M27, M25);
+	const __m256i M34 = AND(M21, M22);
+	const __m256i M35 = AND(M24, M34);
+	const __m256i M36 = XOR(M24, M25);
+	const __m256i M37 = XOR(M21, M29);
+	const __m256i M38 = XOR(M32, M33);
+	const __m256i M39 = XOR(M23, M30);
+	const __m256i M40 = XOR(M35, M36);
+	const __m256i M41 = XOR(M38, M40);
+	const __m256i M42 = XOR(M37, M39);
+	const __m256i M43 = XOR(M37, M38);
+	const __m256i M44 = XOR(M39, M40);
+	const __m256i M45 = XOR(M42, M41);
+	const __m256i M46 = AND(M44, T6);
+	const __m256i M47 = AND(M40, T8);
+	const __m256i M48 = AND(M39, U7);
+	const __m256i M49 = AND(M43, T16);
+	const __m256i M50 = AND(M38, T9);
+	const __m256i M51 = AND(M37, T17);
+	const __m256i M52 = AND(M42, T15);
+	const __m256i M53 = AND(M45, T27);
+	const __m256i M54 = AND(M41, T10);
+	const __m256i M55 = AND(M44, T13);
+	const __m256i M56 = AND(M40, T23);
+	const __m256i M57 = AND(M39, T19);
+	const __m256i M58 = AND(M43, T3);
+	const __m256i M59 = AND(M38, T22);
+	const __m256i M60 = AND(M37, T20);
+	const __m256i M61 = AND(M42, T1);
+	const __m256i M62 = AND(M45, T4);
+	const __m256i M63 = AND(M41, T2);
+	// bottom linear layer
+	const __m256i L0 = XOR(M61, M62);
+	const __m256i L1 = XOR(M50, M56);
+	const __m256i L2 = XOR(M46, M48);
+	const __m256i L3 = XOR(M47, M55);
+	const __m256i L4 = XOR(M54, M58);
+	const __m256i L5 = XOR(M49, M61);
+	const __m256i L6 = XOR(M62, L5);
+	const __m256i L7 = XOR(M46, L3);
+	const __m256i L8 = XOR(M51, M59);
+	const __m256i L9 = XOR(M52, M53);
+	const __m256i L10 = XOR(M53, L4);
+	const __m256i L11 = XOR(M60, L2);
+	const __m256i L12 = XOR(M48, M51);
+	const __m256i L13 = XOR(M50, L0);
+	const __m256i L14 = XOR(M52, M61);
+	const __m256i L15 = XOR(M55, L1);
+	const __m256i L16 = XOR(M56, L0);
+	const __m256i L17 = XOR(M57, L1);
+	const __m256i L18 = XOR(M58, L8);
+	const __m256i L19 = XOR(M63, L4);
+	const __m256i L20 = XOR(L0, L1);
+	const __m256i L21 = XOR(L1, L7);
+	const __m256i L22 = XOR(L3, L12);
+	const __m256i L23 = XOR(L18, L2);
+	const __m256i L24 = XOR(L15, L9);
+	const __m256i L25 = XOR(L6, L10);
+	const __m256i L26 = XOR(L7, L9);
+	const __m256i L27 = XOR(L8, L10);
+	const __m256i L28 = XOR(L11, L14);
+	const __m256i L29 = XOR(L11, L17);
+	x[7] = XOR(L6, L24);
+	x[6] = XOR(XOR(L16, L26), ones);
+	x[5] = XOR(XOR(L19, L28), ones);
+	x[4] = XOR(L6, L21);
+	x[3] = XOR(L20, L22);
+	x[2] = XOR(L25, L29);
+	x[1] = XOR(XOR(L13, L27), ones);
+	x[0] = XOR(XOR(L6, L23), ones);
+	}
+
+// linear part of the inverse affine map: rotl(y,1) ^ rotl(y,3) ^ rotl(y,6) ^ 0x05
+BITSLICE_INLINE void InvAffine(__m256i x[8])
+	{
+	const __m256i ones = _mm256_set1_epi8(-1);
+	__m256i y[8];
+	UNROLL8
+	for (int i = 0; i < 8; i++)
+		y[i] = XOR(XOR(x[(i + 7) % 8], x[(i + 5) % 8]), x[(i + 2) % 8]);
+	UNROLL8
+	for (int i = 0; i < 8; i++)
+		x[i] = y[i];
+	x[0] = XOR(x[0], ones);
+	x[2] = XOR(x[2], ones);
+	}
+
+// InvSubBytes(y) = A'(SubBytes(A'(y))) with the inverse affine map A'
+BITSLICE_INLINE void InvSubBytes(__m256i x[8])
+	{
+	InvAffine(x);
+	SubBytes(x);
+	InvAffine(x);
+	}
+
+BITSLICE_INLINE void ShiftRows(__m256i x[8], const __m256i & same, const __m256i & other)
+	{
+	UNROLL8
+	for (int i = 0; i < 8; i++)
+		{
+		const __m256i swapped = _mm256_permute2x128_si256(x[i], x[i], 0x01);
+		x[i] = _mm256_or_si256(_mm256_shuffle_epi8(x[i], same), _mm256_shuffle_epi8(swapped, other));
+		}
+	}
+
+// multiplication by x in GF(2^8) of all bytes: shift the planes up, reduce by 0x1b
+BITSLICE_INLINE void XTime(const __m256i a[8], __m256i r[8])
+	{
+	r[0] = a[7];
+	r[1] = XOR(a[0], a[7]);
+	r[2] = a[1];
+	r[3] = XOR(a[2], a[7]);
+	r[4] = XOR(a[3], a[7]);
+	r[5] = a[4];
+	r[6] = a[5];
+	r[7] = a[6];
+	}
+
+// b[r] = 2*a[r] ^ 3*a[r+1] ^ a[r+2] ^ a[r+3] = xtime(a[r]^a[r+1]) ^ a[r+1] ^ (a[r+2]^a[r+3])
+BITSLICE_INLINE void MixColumns(__m256i x[8])
+	{
+	const __m256i rot1 = LOAD_MASK(rot1);
+	const __m256i rot2 = LOAD_MASK(rot2);
+	__m256i r1[8], t[8], t2[8];
+	UNROLL8
+	for (int i = 0; i < 8; i++)
+		{
+		r1[i] = _mm256_shuffle_epi8(x[i], rot1);
+		t[i] = XOR(x[i], r1[i]);
+		}
+	XTime(t, t2);
+	UNROLL8
+	for (int i = 0; i < 8; i++)
+		x[i] = XOR(XOR(t2[i], r1[i]), _mm256_shuffle_epi8(t[i], rot2));
+	}
+
+// InvMixColumns = MixColumns after multiplying the columns with 05 00 04 00:
+// a[r] ^= 4*(a[r] ^ a[r+2])
+BITSLICE_INLINE void InvMixColumns(__m256i x[8])
+	{
+	const __m256i rot2 = LOAD_MASK(rot2);
+	__m256i t[8], t2[8], t4[8];
+	UNROLL8
+	for (int i = 0; i < 8; i++)
+		t[i] = XOR(x[i], _mm256_shuffle_epi8(x[i], rot2));
+	XTime(t, t2);
+	XTime(t2, t4);
+	UNROLL8
+	for (int i = 0; i < 8; i++)
+		x[i] = XOR(x[i], t4[i]);
+	MixColumns(x);
+	}
+
+BITSLICE_INLINE void AddRoundKey(__m256i x[8], const __m256i rk[8])
+	{
+	UNROLL8
+	for (int i = 0; i < 8; i++)
+		x[i] = XOR(x[i], rk[i]);
+	}
+
+// bitslice the Nr+1 round keys, lane b uses the schedule W[b]
+BITSLICE_TARGET void ExpandKeys(const unsigned char * const W[8], int32_t Nr, BitsliceKeys & keys)
+	{
+	for (int32_t round = 0; round <= Nr; round++)
+		{
+		UNROLL8
+		for (int b = 0; b < 8; b++)
+			keys.rk[round][b] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(W[b] + 32*round));
+		Transpose(keys.rk[round]);
+		}
+	}
+
+// all lanes with the same key schedule
+BITSLICE_TARGET void ExpandKeys(const unsigned char * W, int32_t Nr, BitsliceKeys & keys)
+	{
+	const unsigned char * lanes[8] = {W, W, W, W, W, W, W, W};
+	ExpandKeys(lanes, Nr, keys);
+	}
+
+BITSLICE_TARGET void Encrypt8(__m256i x[8], const BitsliceKeys & keys, int32_t Nr)
+	{
+	const __m256i same = LOAD_MASK(shiftSame);
+	const __m256i other = LOAD_MASK(shiftOther);
+	AddRoundKey(x, keys.rk[0]);
+	for (int32_t round = 1; round < Nr; round++)
+		{
+		SubBytes(x);
+		ShiftRows(x, same, other);
+		MixColumns(x);
+		AddRoundKey(x, keys.rk[round]);
+		}
+	SubBytes(x);
+	ShiftRows(x, same, other);
+	AddRoundKey(x, keys.rk[Nr]);
+	}
+
+// equivalent inverse cipher, keys from the schedule of AES::StartDecryption
+BITSLICE_TARGET void Decrypt8(__m256i x[8], const BitsliceKeys & keys, int32_t Nr)
+	{
+	const __m256i same = LOAD_MASK(invShiftSame);
+	const __m256i other = LOAD_MASK(invShiftOther);
+	AddRoundKey(x, keys.rk[0]);
+	for (int32_t round = 1; round < Nr; round++)
+		{
+		InvSubBytes(x);
+		ShiftRows(x, same, other);
+		InvMixColumns(x);
+		AddRoundKey(x, keys.rk[round]);
+		}
+	InvSubBytes(x);
+	ShiftRows(x, same, other);
+	AddRoundKey(x, keys.rk[Nr]);
+	}
+
+#undef XOR
+#undef AND
+
+// load n <= 8 consecutive blocks into bit planes, missing blocks are zero
+BITSLICE_INLINE void LoadBlocks(const unsigned char * data, uint32_t n, __m256i x[8])
+	{
+	UNROLL8
+	for (uint32_t b = 0; b < 8; b++)
+		x[b] = (b < n) ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32*b)) : _mm256_setzero_si256();
+	Transpose(x);
+	}
+
+BITSLICE_INLINE void StoreBlocks(__m256i x[8], uint32_t n, unsigned char * data)
+	{
+	Transpose(x);
+	UNROLL8
+	for (uint32_t b = 0; b < n; b++)
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(data + 32*b), x[b]);
+	}
+
+}// end of anonymous namespace
+
+BITSLICE_TARGET
+void AESBitslice_EncryptECB256(const unsigned char * W, int32_t Nr,
+		const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks)
+	{
+	BitsliceKeys keys;
+	ExpandKeys(W, Nr, keys);
+	__m256i x[8];
+	while (numBlocks)
+		{
+		const uint32_t n = (numBlocks < 8) ? numBlocks : 8;
+		LoadBlocks(datain, n, x);
+		Encrypt8(x, keys, Nr);
+		StoreBlocks(x, n, dataout);
+		datain += 32*n;
+		dataout += 32*n;
+		numBlocks -= n;
+		}
+	} // AESBitslice_EncryptECB256
+
+BITSLICE_TARGET
+void AESBitslice_DecryptECB256(const unsigned char * W, int32_t Nr,
+		const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks)
+	{
+	BitsliceKeys keys;
+	ExpandKeys(W, Nr, keys);
+	__m256i x[8];
+	while (numBlocks)
+		{
+		const uint32_t n = (numBlocks < 8) ? numBlocks : 8;
+		LoadBlocks(datain, n, x);
+		Decrypt8(x, keys, Nr);
+		StoreBlocks(x, n, dataout);
+		datain += 32*n;
+		dataout += 32*n;
+		numBlocks -= n;
+		}
+	} // AESBitslice_DecryptECB256
+
+BITSLICE_TARGET
+void AESBitslice_DecryptCBC256(const unsigned char * W, int32_t Nr, const unsigned char * iv,
+		const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks)
+	{
+	BitsliceKeys keys;
+	ExpandKeys(W, Nr, keys);
+	__m256i x[8];
+	__m256i c[8];
+	// previous cipher text block
+	__m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(iv));
+	while (numBlocks)
+		{
+		const uint32_t n = (numBlocks < 8) ? numBlocks : 8;
+		// keep the cipher text, dataout may be the same buffer
+		UNROLL8
+		for (uint32_t b = 0; b < 8; b++)
+			c[b] = x[b] = (b < n) ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(datain + 32*b)) : _mm256_setzero_si256();
+		Transpose(x);
+		Decrypt8(x, keys, Nr);
+		Transpose(x);
+		UNROLL8
+		for (uint32_t b = 0; b < n; b++)
+			{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dataout + 32*b), _mm256_xor_si256(x[b], prev));
+			prev = c[b];
+			}
+		datain += 32*n;
+		dataout += 32*n;
+		numBlocks -= n;
+		}
+	} // AESBitslice_DecryptCBC256
+
+BITSLICE_TARGET
+void AESBitslice_EncryptCBC256(const unsigned char * W, int32_t Nr, const unsigned char * iv,
+		const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks)
+	{
+	BitsliceKeys keys;
+	ExpandKeys(W, Nr, keys);
+	__m256i x[8];
+	__m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(iv));
+	while (numBlocks)
+		{
+		x[0] = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(datain)), prev);
+		UNROLL8
+		for (int b = 1; b < 8; b++)
+			x[b] = _mm256_setzero_si256();
+		Transpose(x);
+		Encrypt8(x, keys, Nr);
+		Transpose(x);
+		prev = x[0];
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dataout), prev);
+		datain += 32;
+		dataout += 32;
+		--numBlocks;
+		}
+	} // AESBitslice_EncryptCBC256
+
+BITSLICE_TARGET
+void AESBitslice_EncryptCBC256Streams(const unsigned char * const * W, int32_t Nr,
+		const unsigned char * const * iv, const unsigned char * const * datain,
+		unsigned char * const * dataout, const uint32_t * numBlocks, uint32_t numStreams)
+	{
+	BitsliceKeys keys;
+	__m256i x[8];
+	__m256i prev[8];
+	for (uint32_t first = 0; first < numStreams; first += 8)
+		{
+		const uint32_t n = (numStreams - first < 8) ? (numStreams - first) : 8;
+		// unused lanes run with the key of the first stream and zero data
+		const unsigned char * laneKeys[8];
+		uint32_t laneBlocks[8];
+		uint32_t maxBlocks = 0;
+		for (uint32_t s = 0; s < 8; s++)
+			{
+			laneKeys[s] = W[first + ((s < n) ? s : 0)];
+			laneBlocks[s] = (s < n) ? numBlocks[first + s] : 0;
+			if (laneBlocks[s] > maxBlocks)
+				maxBlocks = laneBlocks[s];
+			prev[s] = (s < n) ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(iv[first + s])) : _mm256_setzero_si256();
+			}
+		ExpandKeys(laneKeys, Nr, keys);
+
+		for (uint32_t block = 0; block < maxBlocks; block++)
+			{
+			for (uint32_t s = 0; s < 8; s++)
+				x[s] = (block < laneBlocks[s]) ? _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(datain[first + s] + 32*block)), prev[s])
+						: _mm256_setzero_si256();
+			Transpose(x);
+			Encrypt8(x, keys, Nr);
+			Transpose(x);
+			for (uint32_t s = 0; s < n; s++)
+				{
+				prev[s] = x[s];
+				if (block < laneBlocks[s])
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dataout[first + s] + 32*block), x[s]);
+				}
+			}
+		}
+	} // AESBitslice_EncryptCBC256Streams
+
+#else // no x86 - never selected by the AES class
+
+bool AESBitslice_Supported(void)
+	{
+	return false;
+	}
+
+void AESBitslice_EncryptECB256(const unsigned char *, int32_t, const unsigned char *, unsigned char *, uint32_t)
+	{
+	}
+
+void AESBitslice_DecryptECB256(const unsigned char *, int32_t, const unsigned char *, unsigned char *, uint32_t)
+	{
+	}
+
+void AESBitslice_DecryptCBC256(const unsigned char *, int32_t, const unsigned char *, const unsigned char *, unsigned char *, uint32_t)
+	{
+	}
+
+void AESBitslice_EncryptCBC256(const unsigned char *, int32_t, const unsigned char *, const unsigned char *, unsigned char *, uint32_t)
+	{
+	}
+
+void AESBitslice_EncryptCBC256Streams(const unsigned char * const *, int32_t, const unsigned char * const *,
+		const unsigned char * const *, unsigned char * const *, const uint32_t *, uint32_t)
+	{
+	}
+
+#endif
+
+// end - AESBitslice.cpp
@@ -0,0 +1,41 @@
+//============================================================================
+// Name        : AESBitslice.h
+// Description : Bitsliced AVX2 implementation of the Rijndael cipher with
+//             : 256 bit blocks (Nb == 8). Constant time, 8 blocks per pass.
+//             : Only used through the AES class, see AES::SetBackend
+//============================================================================
+
+#ifndef _AESBITSLICE_H
+#define _AESBITSLICE_H
+
+#include <stdint.h>
+
+// true if the CPU has AVX2 and the OS saves the YMM registers
+bool AESBitslice_Supported(void);
+
+// ECB encryption/decryption of numBlocks 32 byte blocks with the key schedule W
+// of StartEncryption resp. StartDecryption, Nr is the number of rounds.
+// datain and dataout may point to the same buffer.
+void AESBitslice_EncryptECB256(const unsigned char * W, int32_t Nr,
+		const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks);
+void AESBitslice_DecryptECB256(const unsigned char * W, int32_t Nr,
+		const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks);
+
+// CBC decryption, 8 blocks in parallel. iv is not changed, in place decryption is allowed.
+void AESBitslice_DecryptCBC256(const unsigned char * W, int32_t Nr, const unsigned char * iv,
+		const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks);
+
+// CBC encryption of one stream. The blocks depend on each other, so only one
+// of the 8 lanes is used; slower than the table code but without secret
+// dependent memory accesses. iv is not changed, in place encryption is allowed.
+void AESBitslice_EncryptCBC256(const unsigned char * W, int32_t Nr, const unsigned char * iv,
+		const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks);
+
+// CBC encryption of numStreams independent streams. Stream s uses the
+// encryption schedule W[s], iv[s] and numBlocks[s] blocks of datain[s] /
+// dataout[s]; up to 8 streams share one pass. The IVs are not changed.
+void AESBitslice_EncryptCBC256Streams(const unsigned char * const * W, int32_t Nr,
+		const unsigned char * const * iv, const unsigned char * const * datain,
+		unsigned char * const * dataout, const uint32_t * numBlocks, uint32_t numStreams);
+
+#endif //  _AESBITSLICE_H
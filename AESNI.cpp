@@ -0,0 +1,459 @@
+//============================================================================
+// Name        : AESNI.cpp
+// Description : AES-NI implementation of the Rijndael cipher with 256 bit
+//             : blocks (Nb == 8) as used by the RSCP protocol.
+//
+// AESENC/AESDEC work on 128 bit states and do the ShiftRows of AES (row r
+// rotated by r columns). Rijndael with 8 columns rotates the rows by 0, 1, 3
+// and 4 columns across the whole 256 bit state. The 256 bit state is kept in
+// two registers (columns 0-3 and 4-7). Before each round the bytes that have
+// to change halves are swapped with a blend and both halves are shuffled, so
+// that the ShiftRows inside AESENC/AESDEC completes the 256 bit ShiftRows.
+// SubBytes works on single bytes and MixColumns on single columns, so both
+// are not affected by the byte shuffle.
+//============================================================================
+
+#include "AESNI.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define AESNI_TARGET __attribute__((target("aes,ssse3,sse4.1")))
+
+bool AESNI_Supported(void)
+	{
+	unsigned int eax, ebx, ecx, edx;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return false;
+	// ECX bit 25 = AES, bit 19 = SSE4.1, bit 9 = SSSE3
+	return (ecx & (1 << 25)) && (ecx & (1 << 19)) && (ecx & (1 << 9));
+	}
+
+// bytes that go to the other half of the state (blend) and the order of the bytes
+// inside one half (shuffle) before AESENC, see comment at top of file
+#define ENC_BLEND   _mm_setr_epi8(0, -128, -128, -128, 0, 0, -128, -128, 0, 0, -128, -128, 0, 0, 0, -128)
+#define ENC_SHUFFLE _mm_setr_epi8(0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13, 2, 3)
+// the same for InvShiftRows before AESDEC
+#define DEC_BLEND   _mm_setr_epi8(0, 0, 0, -128, 0, 0, -128, -128, 0, 0, -128, -128, 0, -128, -128, -128)
+#define DEC_SHUFFLE _mm_setr_epi8(0, 1, 14, 15, 4, 5, 2, 3, 8, 9, 6, 7, 12, 13, 10, 11)
+
+AESNI_TARGET
+void AESNI_EncryptBlock256(const unsigned char * W, int32_t Nr, const unsigned char * datain, unsigned char * dataout)
+	{
+	const __m128i * rk = reinterpret_cast<const __m128i*>(W);
+	const __m128i blend = ENC_BLEND;
+	const __m128i shuffle = ENC_SHUFFLE;
+	__m128i t0, t1;
+
+	__m128i s0 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(datain)), _mm_loadu_si128(rk));
+	__m128i s1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(datain + 16)), _mm_loadu_si128(rk + 1));
+
+	for (int32_t round = 1; round < Nr; round++)
+		{
+		t0 = _mm_shuffle_epi8(_mm_blendv_epi8(s0, s1, blend), shuffle);
+		t1 = _mm_shuffle_epi8(_mm_blendv_epi8(s1, s0, blend), shuffle);
+		s0 = _mm_aesenc_si128(t0, _mm_loadu_si128(rk + 2*round));
+		s1 = _mm_aesenc_si128(t1, _mm_loadu_si128(rk + 2*round + 1));
+		}
+
+	t0 = _mm_shuffle_epi8(_mm_blendv_epi8(s0, s1, blend), shuffle);
+	t1 = _mm_shuffle_epi8(_mm_blendv_epi8(s1, s0, blend), shuffle);
+	s0 = _mm_aesenclast_si128(t0, _mm_loadu_si128(rk + 2*Nr));
+	s1 = _mm_aesenclast_si128(t1, _mm_loadu_si128(rk + 2*Nr + 1));
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(dataout), s0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(dataout + 16), s1);
+	} // AESNI_EncryptBlock256
+
+// W holds the schedule of AES::StartDecryption: the rounds are reversed and
+// InvMixColumns is already applied to the inner round keys, which is exactly
+// the "equivalent inverse cipher" form that AESDEC expects
+AESNI_TARGET
+void AESNI_DecryptBlock256(const unsigned char * W, int32_t Nr, const unsigned char * datain, unsigned char * dataout)
+	{
+	const __m128i * rk = reinterpret_cast<const __m128i*>(W);
+	const __m128i blend = DEC_BLEND;
+	const __m128i shuffle = DEC_SHUFFLE;
+	__m128i t0, t1;
+
+	__m128i s0 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(datain)), _mm_loadu_si128(rk));
+	__m128i s1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(datain + 16)), _mm_loadu_si128(rk + 1));
+
+	for (int32_t round = 1; round < Nr; round++)
+		{
+		t0 = _mm_shuffle_epi8(_mm_blendv_epi8(s0, s1, blend), shuffle);
+		t1 = _mm_shuffle_epi8(_mm_blendv_epi8(s1, s0, blend), shuffle);
+		s0 = _mm_aesdec_si128(t0, _mm_loadu_si128(rk + 2*round));
+		s1 = _mm_aesdec_si128(t1, _mm_loadu_si128(rk + 2*round + 1));
+		}
+
+	t0 = _mm_shuffle_epi8(_mm_blendv_epi8(s0, s1, blend), shuffle);
+	t1 = _mm_shuffle_epi8(_mm_blendv_epi8(s1, s0, blend), shuffle);
+	s0 = _mm_aesdeclast_si128(t0, _mm_loadu_si128(rk + 2*Nr));
+	s1 = _mm_aesdeclast_si128(t1, _mm_loadu_si128(rk + 2*Nr + 1));
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(dataout), s0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(dataout + 16), s1);
+	} // AESNI_DecryptBlock256
+
+// one decryption round for 4 blocks, s0..s7 hold the 4 states
+#define DEC_ROUND4(round, aesfunc) \
+		{ \
+		const __m128i k0 = _mm_loadu_si128(rk + 2*(round)); \
+		const __m128i k1 = _mm_loadu_si128(rk + 2*(round) + 1); \
+		t0 = _mm_shuffle_epi8(_mm_blendv_epi8(s0, s1, blend), shuffle); \
+		t1 = _mm_shuffle_epi8(_mm_blendv_epi8(s1, s0, blend), shuffle); \
+		t2 = _mm_shuffle_epi8(_mm_blendv_epi8(s2, s3, blend), shuffle); \
+		t3 = _mm_shuffle_epi8(_mm_blendv_epi8(s3, s2, blend), shuffle); \
+		t4 = _mm_shuffle_epi8(_mm_blendv_epi8(s4, s5, blend), shuffle); \
+		t5 = _mm_shuffle_epi8(_mm_blendv_epi8(s5, s4, blend), shuffle); \
+		t6 = _mm_shuffle_epi8(_mm_blendv_epi8(s6, s7, blend), shuffle); \
+		t7 = _mm_shuffle_epi8(_mm_blendv_epi8(s7, s6, blend), shuffle); \
+		s0 = aesfunc(t0, k0); \
+		s1 = aesfunc(t1, k1); \
+		s2 = aesfunc(t2, k0); \
+		s3 = aesfunc(t3, k1); \
+		s4 = aesfunc(t4, k0); \
+		s5 = aesfunc(t5, k1); \
+		s6 = aesfunc(t6, k0); \
+		s7 = aesfunc(t7, k1); \
+		}
+
+AESNI_TARGET
+void AESNI_DecryptCBC256(const unsigned char * W, int32_t Nr, const unsigned char * iv,
+		const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks)
+	{
+	const __m128i * rk = reinterpret_cast<const __m128i*>(W);
+	const __m128i * in = reinterpret_cast<const __m128i*>(datain);
+	__m128i * out = reinterpret_cast<__m128i*>(dataout);
+	const __m128i blend = DEC_BLEND;
+	const __m128i shuffle = DEC_SHUFFLE;
+	__m128i s0, s1, s2, s3, s4, s5, s6, s7;
+	__m128i t0, t1, t2, t3, t4, t5, t6, t7;
+
+	// previous cipher text block
+	__m128i p0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv));
+	__m128i p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv + 16));
+
+	while (numBlocks >= 4)
+		{
+		// load all cipher text first, dataout may be the same buffer
+		const __m128i c0 = _mm_loadu_si128(in + 0);
+		const __m128i c1 = _mm_loadu_si128(in + 1);
+		const __m128i c2 = _mm_loadu_si128(in + 2);
+		const __m128i c3 = _mm_loadu_si128(in + 3);
+		const __m128i c4 = _mm_loadu_si128(in + 4);
+		const __m128i c5 = _mm_loadu_si128(in + 5);
+		const __m128i c6 = _mm_loadu_si128(in + 6);
+		const __m128i c7 = _mm_loadu_si128(in + 7);
+
+		t0 = _mm_loadu_si128(rk);
+		t1 = _mm_loadu_si128(rk + 1);
+		s0 = _mm_xor_si128(c0, t0);
+		s1 = _mm_xor_si128(c1, t1);
+		s2 = _mm_xor_si128(c2, t0);
+		s3 = _mm_xor_si128(c3, t1);
+		s4 = _mm_xor_si128(c4, t0);
+		s5 = _mm_xor_si128(c5, t1);
+		s6 = _mm_xor_si128(c6, t0);
+		s7 = _mm_xor_si128(c7, t1);
+
+		for (int32_t round = 1; round < Nr; round++)
+			DEC_ROUND4(round, _mm_aesdec_si128);
+		DEC_ROUND4(Nr, _mm_aesdeclast_si128);
+
+		_mm_storeu_si128(out + 0, _mm_xor_si128(s0, p0));
+		_mm_storeu_si128(out + 1, _mm_xor_si128(s1, p1));
+		_mm_storeu_si128(out + 2, _mm_xor_si128(s2, c0));
+		_mm_storeu_si128(out + 3, _mm_xor_si128(s3, c1));
+		_mm_storeu_si128(out + 4, _mm_xor_si128(s4, c2));
+		_mm_storeu_si128(out + 5, _mm_xor_si128(s5, c3));
+		_mm_storeu_si128(out + 6, _mm_xor_si128(s6, c4));
+		_mm_storeu_si128(out + 7, _mm_xor_si128(s7, c5));
+
+		p0 = c6;
+		p1 = c7;
+		in += 8;
+		out += 8;
+		numBlocks -= 4;
+		}
+
+	// remaining blocks one by one
+	while (numBlocks)
+		{
+		const __m128i c0 = _mm_loadu_si128(in + 0);
+		const __m128i c1 = _mm_loadu_si128(in + 1);
+		unsigned char block[32];
+		AESNI_DecryptBlock256(W, Nr, reinterpret_cast<const unsigned char*>(in), block);
+		_mm_storeu_si128(out + 0, _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)), p0));
+		_mm_storeu_si128(out + 1, _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16)), p1));
+		p0 = c0;
+		p1 = c1;
+		in += 2;
+		out += 2;
+		--numBlocks;
+		}
+	} // AESNI_DecryptCBC256
+
+// CPUs with VAES run AESENC on both 128 bit lanes of a YMM register, so one
+// register holds a whole 256 bit state. The bytes that change halves are
+// taken from the state with swapped lanes. The lane swap adds latency to
+// every round, so 8 streams are interleaved to keep the AES unit busy.
+bool VAES_Supported(void)
+	{
+	unsigned int eax, ebx, ecx, edx;
+	if (!AESNI_Supported() || !__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return false;
+	// ECX bit 27 = OSXSAVE, bit 28 = AVX
+	if (!(ecx & (1 << 27)) || !(ecx & (1 << 28)))
+		return false;
+	// the OS has to save the SSE and AVX state (XCR0 bits 1 and 2)
+	unsigned int xcr0, xcr0High;
+	__asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0High) : "c" (0));
+	if ((xcr0 & 6) != 6)
+		return false;
+	// leaf 7: EBX bit 5 = AVX2, ECX bit 9 = VAES
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+		return false;
+	return (ebx & (1 << 5)) && (ecx & (1 << 9));
+	}
+
+// lane l of a group of streams: key schedule, chaining value and data pointers.
+// Lanes without a stream (or whose stream has no more blocks) run on zero data
+// and are not stored.
+struct StreamLane
+	{
+	const unsigned char * W;
+	const unsigned char * in;
+	unsigned char * out;
+	uint32_t numBlocks;
+	};
+
+static void SetupLanes(StreamLane * lanes, uint32_t numLanes, const unsigned char * const * W,
+		const unsigned char * const * datain, unsigned char * const * dataout, const uint32_t * numBlocks,
+		uint32_t first, uint32_t numStreams, uint32_t & maxBlocks)
+	{
+	maxBlocks = 0;
+	for (uint32_t l = 0; l < numLanes; l++)
+		{
+		const uint32_t s = first + l;
+		const bool used = (s < numStreams);
+		lanes[l].W = W[used ? s : first];
+		lanes[l].in = used ? datain[s] : 0;
+		lanes[l].out = used ? dataout[s] : 0;
+		lanes[l].numBlocks = used ? numBlocks[s] : 0;
+		if (lanes[l].numBlocks > maxBlocks)
+			maxBlocks = lanes[l].numBlocks;
+		}
+	}
+
+// one encryption round of 4 streams with their own round keys
+#define ENC_ROUND4_STREAMS(round, aesfunc) \
+		{ \
+		t0 = _mm_shuffle_epi8(_mm_blendv_epi8(s0, s1, blend), shuffle); \
+		t1 = _mm_shuffle_epi8(_mm_blendv_epi8(s1, s0, blend), shuffle); \
+		t2 = _mm_shuffle_epi8(_mm_blendv_epi8(s2, s3, blend), shuffle); \
+		t3 = _mm_shuffle_epi8(_mm_blendv_epi8(s3, s2, blend), shuffle); \
+		t4 = _mm_shuffle_epi8(_mm_blendv_epi8(s4, s5, blend), shuffle); \
+		t5 = _mm_shuffle_epi8(_mm_blendv_epi8(s5, s4, blend), shuffle); \
+		t6 = _mm_shuffle_epi8(_mm_blendv_epi8(s6, s7, blend), shuffle); \
+		t7 = _mm_shuffle_epi8(_mm_blendv_epi8(s7, s6, blend), shuffle); \
+		s0 = aesfunc(t0, _mm_loadu_si128(rk0 + 2*(round))); \
+		s1 = aesfunc(t1, _mm_loadu_si128(rk0 + 2*(round) + 1)); \
+		s2 = aesfunc(t2, _mm_loadu_si128(rk1 + 2*(round))); \
+		s3 = aesfunc(t3, _mm_loadu_si128(rk1 + 2*(round) + 1)); \
+		s4 = aesfunc(t4, _mm_loadu_si128(rk2 + 2*(round))); \
+		s5 = aesfunc(t5, _mm_loadu_si128(rk2 + 2*(round) + 1)); \
+		s6 = aesfunc(t6, _mm_loadu_si128(rk3 + 2*(round))); \
+		s7 = aesfunc(t7, _mm_loadu_si128(rk3 + 2*(round) + 1)); \
+		}
+
+// load the next plain text block of a lane xor the previous cipher text block
+#define LOAD_LANE(l, lo, hi, prevLo, prevHi) \
+		if (block < lanes[l].numBlocks) \
+			{ \
+			lo = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes[l].in + 32*block)), prevLo); \
+			hi = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes[l].in + 32*block + 16)), prevHi); \
+			} \
+		else \
+			{ \
+			lo = _mm_setzero_si128(); \
+			hi = _mm_setzero_si128(); \
+			}
+
+#define STORE_LANE(l, lo, hi) \
+		if (block < lanes[l].numBlocks) \
+			{ \
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes[l].out + 32*block), lo); \
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes[l].out + 32*block + 16), hi); \
+			}
+
+AESNI_TARGET
+static void AESNI_EncryptCBC256Lanes(const unsigned char * const * W, int32_t Nr, const unsigned char * const * iv,
+		const unsigned char * const * datain, unsigned char * const * dataout, const uint32_t * numBlocks, uint32_t numStreams)
+	{
+	const __m128i blend = ENC_BLEND;
+	const __m128i shuffle = ENC_SHUFFLE;
+	__m128i s0, s1, s2, s3, s4, s5, s6, s7;
+	__m128i t0, t1, t2, t3, t4, t5, t6, t7;
+
+	for (uint32_t first = 0; first < numStreams; first += 4)
+		{
+		StreamLane lanes[4];
+		uint32_t maxBlocks;
+		SetupLanes(lanes, 4, W, datain, dataout, numBlocks, first, numStreams, maxBlocks);
+		const __m128i * rk0 = reinterpret_cast<const __m128i*>(lanes[0].W);
+		const __m128i * rk1 = reinterpret_cast<const __m128i*>(lanes[1].W);
+		const __m128i * rk2 = reinterpret_cast<const __m128i*>(lanes[2].W);
+		const __m128i * rk3 = reinterpret_cast<const __m128i*>(lanes[3].W);
+
+		// previous cipher text block of each lane
+		__m128i p0 = _mm_setzero_si128(), p1 = p0, p2 = p0, p3 = p0, p4 = p0, p5 = p0, p6 = p0, p7 = p0;
+		if (first + 0 < numStreams)
+			{
+			p0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv[first + 0]));
+			p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv[first + 0] + 16));
+			}
+		if (first + 1 < numStreams)
+			{
+			p2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv[first + 1]));
+			p3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv[first + 1] + 16));
+			}
+		if (first + 2 < numStreams)
+			{
+			p4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv[first + 2]));
+			p5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv[first + 2] + 16));
+			}
+		if (first + 3 < numStreams)
+			{
+			p6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv[first + 3]));
+			p7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv[first + 3] + 16));
+			}
+
+		for (uint32_t block = 0; block < maxBlocks; block++)
+			{
+			LOAD_LANE(0, s0, s1, p0, p1);
+			LOAD_LANE(1, s2, s3, p2, p3);
+			LOAD_LANE(2, s4, s5, p4, p5);
+			LOAD_LANE(3, s6, s7, p6, p7);
+			s0 = _mm_xor_si128(s0, _mm_loadu_si128(rk0));
+			s1 = _mm_xor_si128(s1, _mm_loadu_si128(rk0 + 1));
+			s2 = _mm_xor_si128(s2, _mm_loadu_si128(rk1));
+			s3 = _mm_xor_si128(s3, _mm_loadu_si128(rk1 + 1));
+			s4 = _mm_xor_si128(s4, _mm_loadu_si128(rk2));
+			s5 = _mm_xor_si128(s5, _mm_loadu_si128(rk2 + 1));
+			s6 = _mm_xor_si128(s6, _mm_loadu_si128(rk3));
+			s7 = _mm_xor_si128(s7, _mm_loadu_si128(rk3 + 1));
+
+			for (int32_t round = 1; round < Nr; round++)
+				ENC_ROUND4_STREAMS(round, _mm_aesenc_si128);
+			ENC_ROUND4_STREAMS(Nr, _mm_aesenclast_si128);
+
+			STORE_LANE(0, s0, s1);
+			STORE_LANE(1, s2, s3);
+			STORE_LANE(2, s4, s5);
+			STORE_LANE(3, s6, s7);
+			p0 = s0; p1 = s1; p2 = s2; p3 = s3;
+			p4 = s4; p5 = s5; p6 = s6; p7 = s7;
+			}
+		}
+	} // AESNI_EncryptCBC256Lanes
+
+#define VAES_TARGET __attribute__((target("vaes,avx2,aes")))
+// the loops over the 8 lanes have to be unrolled to keep the states in registers
+#define UNROLL8 _Pragma("GCC unroll 8")
+
+// one VAES round of 8 streams, each state in one YMM register
+#define VAES_ROUND_LANE(l, round, aesfunc) \
+		s[l] = aesfunc(_mm256_shuffle_epi8(_mm256_blendv_epi8(s[l], _mm256_permute2x128_si256(s[l], s[l], 0x01), blend), shuffle), \
+				_mm256_loadu_si256(rk[l] + (round)));
+
+VAES_TARGET
+static void VAES_EncryptCBC256Lanes(const unsigned char * const * W, int32_t Nr, const unsigned char * const * iv,
+		const unsigned char * const * datain, unsigned char * const * dataout, const uint32_t * numBlocks, uint32_t numStreams)
+	{
+	const __m256i blend = _mm256_broadcastsi128_si256(ENC_BLEND);
+	const __m256i shuffle = _mm256_broadcastsi128_si256(ENC_SHUFFLE);
+	__m256i s[8], p[8];
+	const __m256i * rk[8];
+
+	for (uint32_t first = 0; first < numStreams; first += 8)
+		{
+		StreamLane lanes[8];
+		uint32_t maxBlocks;
+		SetupLanes(lanes, 8, W, datain, dataout, numBlocks, first, numStreams, maxBlocks);
+		UNROLL8
+		for (int l = 0; l < 8; l++)
+			{
+			rk[l] = reinterpret_cast<const __m256i*>(lanes[l].W);
+			p[l] = (first + l < numStreams) ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(iv[first + l])) : _mm256_setzero_si256();
+			}
+
+		for (uint32_t block = 0; block < maxBlocks; block++)
+			{
+			UNROLL8
+			for (int l = 0; l < 8; l++)
+				{
+				s[l] = (block < lanes[l].numBlocks) ?
+					_mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes[l].in + 32*block)), p[l]) :
+					_mm256_setzero_si256();
+				s[l] = _mm256_xor_si256(s[l], _mm256_loadu_si256(rk[l]));
+				}
+			for (int32_t round = 1; round < Nr; round++)
+				{
+				UNROLL8
+				for (int l = 0; l < 8; l++)
+					VAES_ROUND_LANE(l, round, _mm256_aesenc_epi128);
+				}
+			UNROLL8
+			for (int l = 0; l < 8; l++)
+				{
+				VAES_ROUND_LANE(l, Nr, _mm256_aesenclast_epi128);
+				if (block < lanes[l].numBlocks)
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes[l].out + 32*block), s[l]);
+				p[l] = s[l];
+				}
+			}
+		}
+	} // VAES_EncryptCBC256Lanes
+
+void AESNI_EncryptCBC256Streams(const unsigned char * const * W, int32_t Nr, const unsigned char * const * iv,
+		const unsigned char * const * datain, unsigned char * const * dataout, const uint32_t * numBlocks, uint32_t numStreams)
+	{
+	// the CPU is checked once, the initialization of a local static is thread safe
+	static const bool vaesSupported = VAES_Supported();
+	if (vaesSupported)
+		VAES_EncryptCBC256Lanes(W, Nr, iv, datain, dataout, numBlocks, numStreams);
+	else
+		AESNI_EncryptCBC256Lanes(W, Nr, iv, datain, dataout, numBlocks, numStreams);
+	} // AESNI_EncryptCBC256Streams
+
+#else // no x86 - never selected by the AES class
+
+bool AESNI_Supported(void)
+	{
+	return false;
+	}
+
+void AESNI_EncryptBlock256(const unsigned char *, int32_t, const unsigned char *, unsigned char *)
+	{
+	}
+
+void AESNI_DecryptBlock256(const unsigned char *, int32_t, const unsigned char *, unsigned char *)
+	{
+	}
+
+void AESNI_DecryptCBC256(const unsigned char *, int32_t, const unsigned char *, const unsigned char *, unsigned char *, uint32_t)
+	{
+	}
+
+void AESNI_EncryptCBC256Streams(const unsigned char * const *, int32_t, const unsigned char * const *,
+		const unsigned char * const *, unsigned char * const *, const uint32_t *, uint32_t)
+	{
+	}
+
+#endif
+
+// end - AESNI.cpp
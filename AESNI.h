@@ -0,0 +1,35 @@
+//============================================================================
+// Name        : AESNI.h
+// Description : AES-NI implementation of the Rijndael cipher with 256 bit
+//             : blocks (Nb == 8) as used by the RSCP protocol.
+//             : Only used through the AES class, see AES::SetBackend
+//============================================================================
+
+#ifndef _AESNI_H
+#define _AESNI_H
+
+#include <stdint.h>
+
+// true if the CPU has the AES, SSSE3 and SSE4.1 instructions (checked via CPUID)
+bool AESNI_Supported(void);
+
+// encrypt/decrypt one 32 byte block with the key schedule W of the AES class.
+// W has to be the schedule of StartEncryption resp. StartDecryption, Nr is
+// the number of rounds. datain and dataout may point to the same buffer.
+void AESNI_EncryptBlock256(const unsigned char * W, int32_t Nr, const unsigned char * datain, unsigned char * dataout);
+void AESNI_DecryptBlock256(const unsigned char * W, int32_t Nr, const unsigned char * datain, unsigned char * dataout);
+
+// CBC decryption of numBlocks 32 byte blocks with the decryption schedule W.
+// The blocks do not depend on each other, so 4 of them are decrypted interleaved
+// to keep the AES unit busy. iv is not changed, in place decryption is allowed.
+void AESNI_DecryptCBC256(const unsigned char * W, int32_t Nr, const unsigned char * iv,
+		const unsigned char * datain, unsigned char * dataout, uint32_t numBlocks);
+
+// CBC encryption of numStreams independent streams, stream s uses the encryption
+// schedule W[s], iv[s] and numBlocks[s] blocks of datain[s] / dataout[s].
+// 4 streams are encrypted interleaved; with VAES (if the CPU has it) each
+// state is one YMM register and 8 streams are interleaved. The IVs are not changed.
+void AESNI_EncryptCBC256Streams(const unsigned char * const * W, int32_t Nr, const unsigned char * const * iv,
+		const unsigned char * const * datain, unsigned char * const * dataout, const uint32_t * numBlocks, uint32_t numStreams);
+
+#endif //  _AESNI_H
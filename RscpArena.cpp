@@ -0,0 +1,98 @@
+//============================================================================
+// Name        : RscpArena.cpp
+// Description : Bump allocator for the SRscpValue payloads of one frame
+//============================================================================
+
+#include <stdlib.h>
+#include <string.h>
+#include "RscpArena.h"
+
+// every allocation starts with its size, needed by reallocate()
+#define ARENA_HEADER_SIZE   sizeof(uint64_t)
+#define ARENA_ALIGN(x)      (((x) + 7) & ~(size_t)7)
+
+RscpArena::RscpArena(size_t blockSize) : blockSize(blockSize), current(0), used(0), last(NULL) {
+}
+
+RscpArena::~RscpArena() {
+	for (size_t i = 0; i < blocks.size(); i++) {
+		free(blocks[i].data);
+	}
+}
+
+void * RscpArena::allocate(size_t size) {
+	size_t need = ARENA_HEADER_SIZE + ARENA_ALIGN(size);
+	// use the current block or the next one kept from an earlier frame
+	while ((current < blocks.size()) && (used + need > blocks[current].size)) {
+		current++;
+		used = 0;
+	}
+	if (current >= blocks.size()) {
+		// all blocks are full, get a new one from the heap
+		Block block;
+		block.size = (need > blockSize) ? need : blockSize;
+		block.data = (uint8_t *) malloc(block.size);
+		if (block.data == NULL) {
+			current = blocks.size() ? blocks.size() - 1 : 0;
+			used = blocks.size() ? blocks[current].size : 0;
+			return NULL;
+		}
+		blocks.push_back(block);
+		current = blocks.size() - 1;
+		used = 0;
+	}
+	uint8_t * header = blocks[current].data + used;
+	uint64_t size64 = size;
+	memcpy(header, &size64, sizeof(size64));
+	used += need;
+	last = header + ARENA_HEADER_SIZE;
+	return last;
+}
+
+void * RscpArena::reallocate(void * ptr, size_t size) {
+	if (ptr == NULL) {
+		return allocate(size);
+	}
+	uint8_t * header = (uint8_t *) ptr - ARENA_HEADER_SIZE;
+	uint64_t oldSize;
+	memcpy(&oldSize, header, sizeof(oldSize));
+	// the last allocation can grow or shrink in place
+	if (ptr == last) {
+		size_t start = header - blocks[current].data;
+		if (start + ARENA_HEADER_SIZE + ARENA_ALIGN(size) <= blocks[current].size) {
+			uint64_t size64 = size;
+			memcpy(header, &size64, sizeof(size64));
+			used = start + ARENA_HEADER_SIZE + ARENA_ALIGN(size);
+			return ptr;
+		}
+	}
+	void * newPtr = allocate(size);
+	if (newPtr != NULL) {
+		memcpy(newPtr, ptr, (oldSize < size) ? oldSize : size);
+	}
+	return newPtr;
+}
+
+bool RscpArena::owns(const void * ptr) const {
+	const uint8_t * p = (const uint8_t *) ptr;
+	for (size_t i = 0; (i <= current) && (i < blocks.size()); i++) {
+		if ((p >= blocks[i].data) && (p < blocks[i].data + blocks[i].size)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void RscpArena::reset() {
+	current = 0;
+	used = 0;
+	last = NULL;
+}
+
+size_t RscpArena::capacity() const {
+	size_t total = 0;
+	for (size_t i = 0; i < blocks.size(); i++) {
+		total += blocks[i].size;
+	}
+	return total;
+}
@@ -0,0 +1,72 @@
+//============================================================================
+// Name        : RscpArena.h
+// Description : Bump allocator for the SRscpValue payloads of one frame.
+//             : Allocations only move a pointer forward, everything is
+//             : released at once with reset(). The memory blocks are kept
+//             : for the next frame, so a long running process does not
+//             : fragment the heap.
+//============================================================================
+
+#ifndef RSCPARENA_H_
+#define RSCPARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/*
+ * One arena belongs to one connection resp. thread, it is not thread safe.
+ * Pass it to RscpProtocol to serve all payloads of a frame from it; destroyValueData()
+ * then does not free these payloads, reset() releases all of them in O(1).
+ */
+class RscpArena {
+public:
+	/*
+	 * @param blockSize - Size of the memory blocks taken from the heap,
+	 *                    larger allocations get a block of their own size
+	 */
+	RscpArena(size_t blockSize = 64 * 1024);
+	~RscpArena();
+	/*
+	 * \brief Allocate \var size bytes, aligned to 8 bytes.
+	 * @return Pointer to the memory or NULL if no memory is available
+	 */
+	void * allocate(size_t size);
+	/*
+	 * \brief Resize an allocation of this arena like realloc().
+	 *        The last allocation grows in place if the block has room, otherwise the data is copied.
+	 * @param ptr  - Allocation of this arena or NULL
+	 * @param size - New size in bytes
+	 * @return Pointer to the memory or NULL if no memory is available (\var ptr stays valid)
+	 */
+	void * reallocate(void * ptr, size_t size);
+	/*
+	 * \brief Check if \var ptr was allocated from this arena (and not released yet).
+	 */
+	bool owns(const void * ptr) const;
+	/*
+	 * \brief Release all allocations at once. The blocks are kept for reuse.
+	 */
+	void reset();
+	/*
+	 * \brief Number of bytes currently allocated from the heap for the blocks.
+	 */
+	size_t capacity() const;
+
+private:
+	struct Block {
+		uint8_t * data;
+		size_t size;
+	};
+	// no copies, the blocks belong to exactly one arena
+	RscpArena(const RscpArena &);
+	RscpArena & operator=(const RscpArena &);
+
+	std::vector<Block> blocks;
+	size_t blockSize;
+	size_t current;   // index of the block allocations are taken from
+	size_t used;      // bytes used in the current block
+	uint8_t * last;   // last allocation, may grow in place
+};
+
+#endif /* RSCPARENA_H_ */
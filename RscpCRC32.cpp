@@ -0,0 +1,208 @@
+//============================================================================
+// Name        : RscpCRC32.cpp
+// Description : CRC32 of the RSCP frames (ethernet / zlib polynomial).
+//
+// The table implementations work on the inverted CRC register, the standard
+// form of the reflected CRC32. The nibble table of the original code has the
+// inversion folded into its entries, so it works on the finished CRC directly.
+// The PCLMULQDQ code folds 4 x 128 bits of the message at a time with the
+// constants x^(4*128+32) mod P and x^(4*128-32) mod P (and the same for one
+// 128 bit step), then reduces the last 128 bits to 32 bits with a Barrett
+// reduction, as described in Intel's paper "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction". The constants are the ones of
+// zlib / Chromium (crc32_simd).
+//============================================================================
+
+#include "RscpCRC32.h"
+
+namespace {
+
+// reflected polynomial 0x04C11DB7
+#define CRC32_POLY 0xEDB88320u
+
+// table[0] is the byte wise table, table[k][n] continues table[k-1][n] by one zero byte
+struct CRC32Tables {
+	uint32_t table[8][256];
+
+	constexpr CRC32Tables() : table() {
+		for (uint32_t n = 0; n < 256; n++) {
+			uint32_t c = n;
+			for (int k = 0; k < 8; k++) {
+				c = (c & 1) ? (c >> 1) ^ CRC32_POLY : (c >> 1);
+			}
+			table[0][n] = c;
+		}
+		for (uint32_t n = 0; n < 256; n++) {
+			for (int k = 1; k < 8; k++) {
+				table[k][n] = (table[k - 1][n] >> 8) ^ table[0][table[k - 1][n] & 0xFF];
+			}
+		}
+	}
+};
+
+constexpr CRC32Tables crc32Tables;
+
+inline uint32_t load32(const uint8_t * p) {
+	// the compiler turns this into one load on little endian CPUs
+	return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+} // namespace
+
+uint32_t RscpCRC32_UpdateNibble(uint32_t crc, const uint8_t * data, size_t length) {
+	static const uint32_t crc_table[] = {
+		0x4DBDF21C, 0x500AE278, 0x76D3D2D4, 0x6B64C2B0,
+		0x3B61B38C, 0x26D6A3E8, 0x000F9344, 0x1DB88320,
+		0xA005713C, 0xBDB26158, 0x9B6B51F4, 0x86DC4190,
+		0xD6D930AC, 0xCB6E20C8, 0xEDB71064, 0xF0000000
+	};
+	for (size_t n = 0; n < length; n++) {
+		crc = (crc >> 4) ^ crc_table[(crc ^ (data[n] >> 0)) & 0x0F];  /* lower nibble */
+		crc = (crc >> 4) ^ crc_table[(crc ^ (data[n] >> 4)) & 0x0F];  /* upper nibble */
+	}
+	return crc;
+}
+
+uint32_t RscpCRC32_UpdateSlice8(uint32_t crc, const uint8_t * data, size_t length) {
+	const uint32_t (* t)[256] = crc32Tables.table;
+	uint32_t c = ~crc;
+	while (length >= 8) {
+		uint32_t one = load32(data) ^ c;
+		uint32_t two = load32(data + 4);
+		c = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24] ^
+			t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
+		data += 8;
+		length -= 8;
+	}
+	while (length-- > 0) {
+		c = (c >> 8) ^ t[0][(c ^ *data++) & 0xFF];
+	}
+	return ~c;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define PCLMUL_TARGET __attribute__((target("pclmul,sse2")))
+
+bool RscpCRC32_PCLMULSupported(void) {
+	unsigned int eax, ebx, ecx, edx;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+		return false;
+	}
+	// ECX bit 1 = PCLMULQDQ
+	return (ecx & (1 << 1)) != 0;
+}
+
+PCLMUL_TARGET
+uint32_t RscpCRC32_UpdatePCLMUL(uint32_t crc, const uint8_t * data, size_t length) {
+	if (length < 64) {
+		return RscpCRC32_UpdateSlice8(crc, data, length);
+	}
+	alignas(16) static const uint64_t k1k2[] = { 0x0154442bd4, 0x01c6e41596 };
+	alignas(16) static const uint64_t k3k4[] = { 0x01751997d0, 0x00ccaa009e };
+	alignas(16) static const uint64_t k5k0[] = { 0x0163cd6124, 0x0000000000 };
+	alignas(16) static const uint64_t poly[] = { 0x01db710641, 0x01f7011641 };
+	const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+	__m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+	// the tail that is not a multiple of 16 bytes is done with the tables
+	size_t tail = length & 15;
+	length -= tail;
+
+	x1 = _mm_loadu_si128((const __m128i *) (data + 0x00));
+	x2 = _mm_loadu_si128((const __m128i *) (data + 0x10));
+	x3 = _mm_loadu_si128((const __m128i *) (data + 0x20));
+	x4 = _mm_loadu_si128((const __m128i *) (data + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int) ~crc));
+	x0 = _mm_load_si128((const __m128i *) k1k2);
+	data += 64;
+	length -= 64;
+
+	// fold 4 x 128 bits in parallel
+	while (length >= 64) {
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *) (data + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *) (data + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *) (data + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *) (data + 0x30)));
+		data += 64;
+		length -= 64;
+	}
+
+	// fold the 4 registers into one
+	x0 = _mm_load_si128((const __m128i *) k3k4);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+	// fold the remaining 16 byte blocks
+	while (length >= 16) {
+		x2 = _mm_loadu_si128((const __m128i *) data);
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+		data += 16;
+		length -= 16;
+	}
+
+	// fold 128 bits to 64 bits
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	x0 = _mm_loadl_epi64((const __m128i *) k5k0);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, mask32);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	// Barrett reduction to 32 bits
+	x0 = _mm_load_si128((const __m128i *) poly);
+	x2 = _mm_and_si128(x1, mask32);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+	x2 = _mm_and_si128(x2, mask32);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	uint32_t c = (uint32_t) _mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+
+	return RscpCRC32_UpdateSlice8(~c, data, tail);
+}
+
+uint32_t RscpCRC32_Update(uint32_t crc, const uint8_t * data, size_t length) {
+	// the CPU is checked once, the initialization of a local static is thread safe
+	static const bool pclmulSupported = RscpCRC32_PCLMULSupported();
+	if (pclmulSupported) {
+		return RscpCRC32_UpdatePCLMUL(crc, data, length);
+	}
+	return RscpCRC32_UpdateSlice8(crc, data, length);
+}
+
+#else // no x86
+
+bool RscpCRC32_PCLMULSupported(void) {
+	return false;
+}
+
+uint32_t RscpCRC32_UpdatePCLMUL(uint32_t crc, const uint8_t * data, size_t length) {
+	return RscpCRC32_UpdateSlice8(crc, data, length);
+}
+
+uint32_t RscpCRC32_Update(uint32_t crc, const uint8_t * data, size_t length) {
+	return RscpCRC32_UpdateSlice8(crc, data, length);
+}
+
+#endif
@@ -0,0 +1,31 @@
+//============================================================================
+// Name        : RscpCRC32.h
+// Description : CRC32 of the RSCP frames (ethernet / zlib polynomial).
+//             : The state passed in and returned is the finished CRC, so
+//             : RscpCRC32_Update(RscpCRC32_Update(0, a), b) is the CRC of a
+//             : followed by b. All implementations return identical values.
+//============================================================================
+
+#ifndef RSCPCRC32_H_
+#define RSCPCRC32_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// continue crc over length bytes of data with the fastest implementation of the CPU
+uint32_t RscpCRC32_Update(uint32_t crc, const uint8_t * data, size_t length);
+
+// original implementation with a 16 entry table, two dependent lookups per byte
+uint32_t RscpCRC32_UpdateNibble(uint32_t crc, const uint8_t * data, size_t length);
+
+// slicing-by-8, eight independent lookups per 8 bytes (8 KB of tables)
+uint32_t RscpCRC32_UpdateSlice8(uint32_t crc, const uint8_t * data, size_t length);
+
+// true if the CPU has the PCLMULQDQ instruction (checked via CPUID)
+bool RscpCRC32_PCLMULSupported(void);
+
+// folding with carry-less multiplication, 64 bytes per pass; short buffers and
+// the last bytes use slicing-by-8. Must only be called if RscpCRC32_PCLMULSupported()
+uint32_t RscpCRC32_UpdatePCLMUL(uint32_t crc, const uint8_t * data, size_t length);
+
+#endif /* RSCPCRC32_H_ */
@@ -0,0 +1,80 @@
+//============================================================================
+// Name        : RscpCipher.cpp
+// Description : Encryption state of one RSCP connection
+//============================================================================
+
+#include <string.h>
+#include "RscpCipher.h"
+
+RscpCipher::RscpCipher() {
+	memset(encryptionIV, 0xff, AES_BLOCK_SIZE);
+	memset(decryptionIV, 0xff, AES_BLOCK_SIZE);
+}
+
+void RscpCipher::init(const char * password) {
+	// initialize AES encryptor and decryptor IV
+	memset(decryptionIV, 0xff, AES_BLOCK_SIZE);
+	memset(encryptionIV, 0xff, AES_BLOCK_SIZE);
+
+	// limit password length to AES_KEY_SIZE
+	int iPasswordLength = strlen(password);
+	if (iPasswordLength > AES_KEY_SIZE)
+		iPasswordLength = AES_KEY_SIZE;
+
+	// copy up to 32 bytes of AES key password
+	uint8_t ucAesKey[AES_KEY_SIZE];
+	memset(ucAesKey, 0xff, AES_KEY_SIZE);
+	memcpy(ucAesKey, password, iPasswordLength);
+
+	// set encryptor and decryptor parameters
+	decrypter.SetParameters(AES_KEY_SIZE * 8, AES_BLOCK_SIZE * 8);
+	encrypter.SetParameters(AES_KEY_SIZE * 8, AES_BLOCK_SIZE * 8);
+	decrypter.StartDecryption(ucAesKey);
+	encrypter.StartEncryption(ucAesKey);
+}
+
+void RscpCipher::encrypt(uint8_t * data, uint32_t length) {
+	if (length < AES_BLOCK_SIZE) {
+		return;
+	}
+	// set continues encryption IV
+	encrypter.SetIV(encryptionIV, AES_BLOCK_SIZE);
+	encrypter.Encrypt(data, data, length / AES_BLOCK_SIZE);
+	// save new IV for next encryption block
+	memcpy(encryptionIV, data + length - AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+}
+
+void RscpCipher::decrypt(const uint8_t * datain, uint8_t * dataout, uint32_t length) {
+	if (length < AES_BLOCK_SIZE) {
+		return;
+	}
+	// the last cipher text block is the IV of the next call, save it before in place decryption
+	uint8_t nextIV[AES_BLOCK_SIZE];
+	memcpy(nextIV, datain + length - AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+	decrypter.SetIV(decryptionIV, AES_BLOCK_SIZE);
+	decrypter.Decrypt(datain, dataout, length / AES_BLOCK_SIZE);
+	memcpy(decryptionIV, nextIV, AES_BLOCK_SIZE);
+}
+
+void RscpCipher::encrypt(RscpCipher * const * ciphers, uint8_t * const * data, const uint32_t * length, uint32_t numStreams) {
+	// work on groups of connections, so no memory has to be allocated
+	const uint32_t groupSize = 16;
+	AES * encrypters[groupSize];
+	uint32_t numBlocks[groupSize];
+	for (uint32_t group = 0; group < numStreams; group += groupSize) {
+		const uint32_t n = (numStreams - group < groupSize) ? (numStreams - group) : groupSize;
+		for (uint32_t i = 0; i < n; i++) {
+			RscpCipher * cipher = ciphers[group + i];
+			cipher->encrypter.SetIV(cipher->encryptionIV, AES_BLOCK_SIZE);
+			encrypters[i] = &cipher->encrypter;
+			numBlocks[i] = length[group + i] / AES_BLOCK_SIZE;
+		}
+		AES::EncryptStreams(encrypters, data + group, data + group, numBlocks, n);
+		// save new IVs for the next encryption
+		for (uint32_t i = 0; i < n; i++) {
+			if (numBlocks[i] > 0) {
+				memcpy(ciphers[group + i]->encryptionIV, data[group + i] + numBlocks[i] * AES_BLOCK_SIZE - AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+			}
+		}
+	}
+}
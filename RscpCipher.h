@@ -0,0 +1,62 @@
+//============================================================================
+// Name        : RscpCipher.h
+// Description : Encryption state of one RSCP connection. The S10 uses
+//             : Rijndael with 256 bit key and 256 bit blocks in CBC mode;
+//             : both directions continue their IV over the whole connection.
+//============================================================================
+
+#ifndef RSCPCIPHER_H_
+#define RSCPCIPHER_H_
+
+#include <stdint.h>
+#include "AES.h"
+
+#define AES_KEY_SIZE        32
+#define AES_BLOCK_SIZE      32
+
+/*
+ * All state of one connection is inside the object, it can be copied like a value.
+ * Objects of different connections can be used on different threads at the same time.
+ */
+class RscpCipher {
+public:
+	RscpCipher();
+	/*
+	 * \brief Set up encryptor and decryptor for a new connection.
+	 *        The key is the AES password (max. AES_KEY_SIZE bytes, padded with 0xff),
+	 *        both IVs are reset to 0xff.
+	 * @param password - AES password shared with the S10
+	 */
+	void init(const char * password);
+	/*
+	 * \brief Encrypt \var length bytes in place and continue the IV of the connection.
+	 * @param data   - Buffer with the plain frame, zero padded
+	 * @param length - Length in bytes, must be a multiple of AES_BLOCK_SIZE
+	 */
+	void encrypt(uint8_t * data, uint32_t length);
+	/*
+	 * \brief Decrypt \var length bytes and continue the IV of the connection.
+	 *        Each received block has to be decrypted exactly once and in order.
+	 * @param datain  - Received cipher text
+	 * @param dataout - Buffer for the plain text, may be the same as datain
+	 * @param length  - Length in bytes, must be a multiple of AES_BLOCK_SIZE
+	 */
+	void decrypt(const uint8_t * datain, uint8_t * dataout, uint32_t length);
+	/*
+	 * \brief Encrypt the frames of several connections in place at once and continue their IVs.
+	 *        With AES-NI or AVX2 the connections are encrypted in parallel, see AES::EncryptStreams.
+	 * @param ciphers    - Cipher of each connection, all set up with init()
+	 * @param data       - Buffer with the plain frame of each connection, zero padded
+	 * @param length     - Length of each frame in bytes, a multiple of AES_BLOCK_SIZE
+	 * @param numStreams - Number of connections
+	 */
+	static void encrypt(RscpCipher * const * ciphers, uint8_t * const * data, const uint32_t * length, uint32_t numStreams);
+
+	AES encrypter;
+	AES decrypter;
+	// IV of the next block to send resp. receive (last cipher text block)
+	uint8_t encryptionIV[AES_BLOCK_SIZE];
+	uint8_t decryptionIV[AES_BLOCK_SIZE];
+};
+
+#endif /* RSCPCIPHER_H_ */
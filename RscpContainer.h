@@ -0,0 +1,111 @@
+//============================================================================
+// Name        : RscpContainer.h
+// Description : Range over the values of a RSCP container that reads them in
+//             : place. Nothing is allocated or copied, so there is nothing
+//             : to free, unlike RscpProtocol::getValueAsContainer().
+//============================================================================
+
+#ifndef RSCPCONTAINER_H_
+#define RSCPCONTAINER_H_
+
+#include <stddef.h>
+#include <string.h>
+#include "RscpTypes.h"
+
+/*
+ * Forward iterator over raw tag data. The values it yields point into the data (zero copy)
+ * and are valid as long as the data. A value that does not fit into the data ends the
+ * iteration like in RscpProtocol::parseData().
+ */
+class RscpContainerIterator {
+public:
+	RscpContainerIterator() : pos(NULL), end(NULL) {
+		memset(&current, 0, sizeof(current));
+	}
+	RscpContainerIterator(const uint8_t * data, const uint8_t * end) : pos(data), end(end) {
+		read();
+	}
+	const SRscpValue & operator*() const {
+		return current;
+	}
+	const SRscpValue * operator->() const {
+		return &current;
+	}
+	RscpContainerIterator & operator++() {
+		pos += headerSize + current.length;
+		read();
+		return *this;
+	}
+	RscpContainerIterator operator++(int) {
+		RscpContainerIterator tmp(*this);
+		++(*this);
+		return tmp;
+	}
+	bool operator==(const RscpContainerIterator & other) const {
+		return pos == other.pos;
+	}
+	bool operator!=(const RscpContainerIterator & other) const {
+		return pos != other.pos;
+	}
+
+private:
+	// size of a value without its data (tag, data type and length)
+	static const size_t headerSize = sizeof(SRscpValue) - sizeof(uint8_t *);
+
+	// read the value at pos or become the end iterator
+	void read() {
+		if((pos == NULL) || (pos + headerSize > end)) {
+			pos = NULL;
+			return;
+		}
+		const SRscpValue * value = reinterpret_cast<const SRscpValue *>(pos);
+		if(pos + headerSize + value->length > end) {
+			pos = NULL;
+			return;
+		}
+		current.tag = value->tag;
+		current.dataType = value->dataType;
+		current.length = value->length;
+		current.data = (value->length > 0) ? (uint8_t *) &value->data : NULL;
+	}
+
+	const uint8_t * pos;    // current value, NULL at the end
+	const uint8_t * end;
+	SRscpValue current;
+};
+
+/*
+ * The values of a container, for use in range based for loops:
+ *   for (const SRscpValue & value : RscpContainerRange(response)) { ... }
+ */
+class RscpContainerRange {
+public:
+    /*
+     * @param container - Container value, e.g. of a frame parsed with RscpProtocol::parseFrame()
+     */
+	RscpContainerRange(const SRscpValue * container) :
+			data((container != NULL) ? container->data : NULL),
+			length(((container != NULL) && (container->data != NULL)) ? container->length : 0) {
+	}
+    /*
+     * @param data   - Pointer to the first RSCP value struct in line (e.g. the data of a frame)
+     * @param length - Length of data in bytes
+     */
+	RscpContainerRange(const uint8_t * data, uint32_t length) : data(data), length((data != NULL) ? length : 0) {
+	}
+	RscpContainerIterator begin() const {
+		return RscpContainerIterator(data, data + length);
+	}
+	RscpContainerIterator end() const {
+		return RscpContainerIterator();
+	}
+	bool empty() const {
+		return begin() == end();
+	}
+
+private:
+	const uint8_t * data;
+	uint32_t length;
+};
+
+#endif /* RSCPCONTAINER_H_ */
@@ -0,0 +1,249 @@
+//============================================================================
+// Name        : RscpEventLoop.cpp
+// Description : Runs many RscpSessions in one thread with epoll
+//============================================================================
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include "RscpEventLoop.h"
+#include "SocketConnection.h"
+
+// events handled per epoll_wait
+#define RSCP_EVENTS 64
+
+RscpEventLoop::RscpEventLoop() :
+		open(0), failed(0) {
+	epollFd = epoll_create1(EPOLL_CLOEXEC);
+}
+
+RscpEventLoop::~RscpEventLoop() {
+	for (size_t i = 0; i < connections.size(); i++) {
+		if (connections[i]->fd >= 0) {
+			SocketClose(connections[i]->fd);
+		}
+		delete connections[i];
+	}
+	if (epollFd >= 0) {
+		::close(epollFd);
+	}
+}
+
+bool RscpEventLoop::add(RscpSession * session) {
+	SConnection * connection = new SConnection;
+	init(connection, session);
+	connection->fd = -1;
+	connections.push_back(connection);
+	open++;
+	return connect(connection);
+}
+
+bool RscpEventLoop::connect(SConnection * connection) {
+	RscpSession * session = connection->session;
+	session->connecting();
+	int fd = (epollFd >= 0) ? SocketConnectNonBlocking(session->getIp(), session->getPort()) : -1;
+	if (fd < 0) {
+		ended(connection, (epollFd >= 0) ? errno : ENOSYS);
+		return false;
+	}
+	struct epoll_event event;
+	event.events = EPOLLIN | EPOLLOUT;
+	event.data.ptr = connection;
+	if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+		int error = errno;
+		SocketClose(fd);
+		ended(connection, error);
+		return false;
+	}
+	connection->fd = fd;
+	connection->events = event.events;
+	wheel.schedule(&connection->timer, RscpTimerWheel::now(), timeoutMs);
+	return true;
+}
+
+void RscpEventLoop::ended(SConnection * connection, int error) {
+	RscpSession * session = connection->session;
+	session->fail(error);
+	if (waitForRetry(connection)) {
+		return;
+	}
+	open--;
+	if (session->getState() == RscpSession::eStateFailed) {
+		failed++;
+	}
+}
+
+int RscpEventLoop::run() {
+	if (epollFd < 0) {
+		return -1;
+	}
+	struct epoll_event events[RSCP_EVENTS];
+	while (open > 0) {
+		int n = epoll_wait(epollFd, events, RSCP_EVENTS, wheel.getTimeout(RscpTimerWheel::now()));
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			// the loop can not go on, all open sessions fail
+			int error = errno;
+			for (size_t i = 0; i < connections.size(); i++) {
+				if (connections[i]->fd >= 0) {
+					closeConnection(connections[i], error);
+				}
+				if (connections[i]->waiting) {
+					connections[i]->waiting = false;
+					connections[i]->session->abort(error);
+					open--;
+					failed++;
+				}
+			}
+			break;
+		}
+		for (int i = 0; i < n; i++) {
+			handleEvent((SConnection *) events[i].data.ptr, events[i].events);
+		}
+
+		expireTimers();
+		flush();
+
+		// the events of this round may have pointed to the closed connections, now they can go
+		size_t kept = 0;
+		for (size_t i = 0; i < connections.size(); i++) {
+			if ((connections[i]->fd >= 0) || connections[i]->waiting) {
+				connections[kept++] = connections[i];
+			} else {
+				delete connections[i];
+			}
+		}
+		connections.resize(kept);
+	}
+	return failed;
+}
+
+void RscpEventLoop::handleEvent(SConnection * connection, uint32_t events) {
+	if (connection->fd < 0) {
+		return;
+	}
+	RscpSession * session = connection->session;
+	if (session->getState() == RscpSession::eStateConnecting) {
+		if (events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) {
+			int error = SocketConnectResult(connection->fd);
+			if (error != 0) {
+				closeConnection(connection, error);
+				return;
+			}
+			session->connected();
+			wheel.schedule(&connection->timer, RscpTimerWheel::now(), timeoutMs);
+			queueFrames(connection);
+			updateEvents(connection);
+		}
+		return;
+	}
+	if (events & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+		receiveData(connection);
+	}
+	if ((connection->fd >= 0) && (events & EPOLLOUT)) {
+		sendData(connection);
+	}
+}
+
+void RscpEventLoop::receiveData(SConnection * connection) {
+	RscpSession * session = connection->session;
+	for (;;) {
+		uint32_t length;
+		uint8_t * space = session->getReceiveSpace(length);
+		if (space == NULL) {
+			closeConnection(connection, session->getError());
+			return;
+		}
+		ssize_t iResult = recv(connection->fd, space, length, 0);
+		if (iResult < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+				closeConnection(connection, errno);
+			}
+			return;
+		}
+		if (iResult == 0) {
+			// connection was closed by peer, on startup e.g. a wrong AES password
+			closeConnection(connection, ECONNRESET);
+			return;
+		}
+		wheel.schedule(&connection->timer, RscpTimerWheel::now(), timeoutMs);
+		if (!session->received(iResult)) {
+			closeConnection(connection, session->getError());
+			return;
+		}
+		queueFrames(connection);
+		if ((uint32_t) iResult < length) {
+			// the socket is empty, no need for another recv that returns EAGAIN
+			return;
+		}
+	}
+}
+
+void RscpEventLoop::sendData(SConnection * connection) {
+	RscpSession * session = connection->session;
+	uint32_t length;
+	const uint8_t * data;
+	while ((data = session->getSendData(length)) != NULL) {
+		ssize_t iResult = ::send(connection->fd, data, length, MSG_NOSIGNAL);
+		if (iResult < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+				closeConnection(connection, errno);
+				return;
+			}
+			break;
+		}
+		session->sent(iResult);
+	}
+	updateEvents(connection);
+}
+
+void RscpEventLoop::updateEvents(SConnection * connection) {
+	if (connection->fd < 0) {
+		return;
+	}
+	uint32_t events = EPOLLIN;
+	if ((connection->session->getState() == RscpSession::eStateConnecting) || connection->session->wantsToSend()) {
+		events |= EPOLLOUT;
+	}
+	if (events != connection->events) {
+		struct epoll_event event;
+		event.events = events;
+		event.data.ptr = connection;
+		if (epoll_ctl(epollFd, EPOLL_CTL_MOD, connection->fd, &event) == 0) {
+			connection->events = events;
+		}
+	}
+}
+
+bool RscpEventLoop::isOpen(const SSessionConnection * connection) const {
+	return ((const SConnection *) connection)->fd >= 0;
+}
+
+void RscpEventLoop::sendFrames(SSessionConnection * connection) {
+	sendData((SConnection *) connection);
+}
+
+void RscpEventLoop::reconnect(SSessionConnection * connection) {
+	connect((SConnection *) connection);
+}
+
+void RscpEventLoop::closeConnection(SSessionConnection * sessionConnection, int error) {
+	SConnection * connection = (SConnection *) sessionConnection;
+	if (connection->fd < 0) {
+		return;
+	}
+	wheel.cancel(&connection->timer);
+	epoll_ctl(epollFd, EPOLL_CTL_DEL, connection->fd, NULL);
+	SocketClose(connection->fd);
+	connection->fd = -1;
+	ended(connection, error);
+}
@@ -0,0 +1,58 @@
+//============================================================================
+// Name        : RscpEventLoop.h
+// Description : Runs many RscpSessions in one thread: non blocking sockets,
+//             : epoll and a timer wheel for the timeouts, see
+//             : RscpSessionLoop.
+//============================================================================
+
+#ifndef RSCPEVENTLOOP_H_
+#define RSCPEVENTLOOP_H_
+
+#include <vector>
+#include "RscpSessionLoop.h"
+
+class RscpEventLoop : public RscpSessionLoop {
+public:
+	RscpEventLoop();
+	~RscpEventLoop();
+    /*
+     * \brief Start to connect \var session, it is run by run(). The session must stay valid until run() returns.
+     *        A session in RscpSession::eStateBackoff after a failure is connected again after its retry delay.
+     * @return - false if the connect failed at once, the session has failed or waits for a retry then
+     */
+	bool add(RscpSession * session);
+    /*
+     * \brief Run until all added sessions are finished. A failing session does not stop the others.
+     * @return - Number of failed sessions, -1 if epoll is not available
+     */
+	int run();
+
+private:
+	struct SConnection : public SSessionConnection {
+		int fd;
+		uint32_t events;    // registered epoll events
+	};
+
+	// open a socket for the session of \var connection and start to connect
+	bool connect(SConnection * connection);
+	// the session of \var connection has no socket any more: wait for a retry or count it as ended
+	void ended(SConnection * connection, int error);
+	void handleEvent(SConnection * connection, uint32_t events);
+	void receiveData(SConnection * connection);
+	void sendData(SConnection * connection);
+	// register EPOLLOUT only while there is something to send resp. the connect is in progress
+	void updateEvents(SConnection * connection);
+
+	bool isOpen(const SSessionConnection * connection) const;
+	void sendFrames(SSessionConnection * connection);
+	void reconnect(SSessionConnection * connection);
+	// the connection is deleted after the round
+	void closeConnection(SSessionConnection * connection, int error);
+
+	int epollFd;
+	std::vector<SConnection *> connections;
+	size_t open;
+	int failed;
+};
+
+#endif /* RSCPEVENTLOOP_H_ */
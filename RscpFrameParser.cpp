@@ -0,0 +1,101 @@
+//============================================================================
+// Name        : RscpFrameParser.cpp
+// Description : Resumable parser for RSCP frames that arrive in pieces
+//============================================================================
+
+#include "RscpFrameParser.h"
+#include "RscpCRC32.h"
+
+// size of a value without its data (tag, data type and length)
+#define VALUE_HEADER_SIZE   (sizeof(SRscpValue) - sizeof(((SRscpValue *) 0)->data))
+
+RscpFrameParser::RscpFrameParser() {
+	memset(&header, 0, sizeof(header));
+	reset();
+}
+
+void RscpFrameParser::reset() {
+	// the header of the last frame stays readable until the next header arrives
+	state = eStateHeader;
+	frameLength = 0;
+	valuePos = 0;
+	crcPos = 0;
+	uCRC32 = 0;
+}
+
+int32_t RscpFrameParser::parse(const uint8_t * data, uint32_t length, std::vector<SRscpValue> & values) {
+	if(data == NULL) {
+		return RSCP::ERR_INVALID_INPUT;
+	}
+	if(state == eStateHeader) {
+		// the header is checked only once
+		int32_t iResult = protocol.getFrameLength(data, length);
+		if(iResult == RSCP::ERR_INVALID_FRAME_LENGTH) {
+			return 0;
+		}
+		if(iResult < 0) {
+			reset();
+			return iResult;
+		}
+		frameLength = iResult;
+		memcpy(&header, data, sizeof(header));
+		valuePos = sizeof(SRscpFrameHeader);
+		state = eStateValues;
+	}
+	// bytes of the current frame that are here, following frames are not touched
+	uint32_t available = (length < frameLength) ? length : frameLength;
+	uint32_t dataEnd = sizeof(SRscpFrameHeader) + header.dataLength;
+
+	// continue the CRC over the new bytes while they are still in the cache
+	if(header.ctrl.bits.crc != 0) {
+		uint32_t crcEnd = (available < dataEnd) ? available : dataEnd;
+		if(crcEnd > crcPos) {
+			uCRC32 = RscpCRC32_Update(uCRC32, data + crcPos, crcEnd - crcPos);
+			crcPos = crcEnd;
+		}
+	}
+
+	// return every value that is complete now
+	while(state == eStateValues) {
+		if(valuePos + VALUE_HEADER_SIZE > dataEnd) {
+			// no more values in this frame
+			state = eStateCRC;
+			break;
+		}
+		if(valuePos + VALUE_HEADER_SIZE > available) {
+			break;
+		}
+		const SRscpValue * value = reinterpret_cast<const SRscpValue *>(data + valuePos);
+		uint32_t valueEnd = valuePos + VALUE_HEADER_SIZE + value->length;
+		if(valueEnd > dataEnd) {
+			// the value does not fit into the frame, ignore the rest like RscpProtocol::parseData()
+			state = eStateCRC;
+			break;
+		}
+		if(valueEnd > available) {
+			break;
+		}
+		SRscpValue newVal;
+		newVal.tag = value->tag;
+		newVal.dataType = value->dataType;
+		newVal.length = value->length;
+		newVal.data = (value->length > 0) ? (uint8_t *) &value->data : NULL;
+		values.push_back(newVal);
+		valuePos = valueEnd;
+	}
+
+	if((state != eStateCRC) || (available < frameLength)) {
+		return 0;
+	}
+	// the frame is complete
+	int32_t iResult = frameLength;
+	if(header.ctrl.bits.crc != 0) {
+		uint32_t frameCRC32;
+		memcpy(&frameCRC32, data + dataEnd, sizeof(frameCRC32));
+		if(frameCRC32 != uCRC32) {
+			iResult = RSCP::ERR_INVALID_CRC;
+		}
+	}
+	reset();
+	return iResult;
+}
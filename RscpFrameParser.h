@@ -0,0 +1,62 @@
+//============================================================================
+// Name        : RscpFrameParser.h
+// Description : Resumable parser for RSCP frames that arrive in pieces.
+//             : Every call only looks at the bytes that are new since the
+//             : last call: the header is checked once, the CRC is updated
+//             : over the new bytes and each top level value is returned as
+//             : soon as all of its bytes are there.
+//============================================================================
+
+#ifndef RSCPFRAMEPARSER_H_
+#define RSCPFRAMEPARSER_H_
+
+#include <vector>
+#include "RscpTypes.h"
+#include "RscpProtocol.h"
+
+class RscpFrameParser {
+public:
+	RscpFrameParser();
+    /*
+     * \brief Forget the current frame, the next call of parse() expects the header of a new frame.
+     */
+	void reset();
+    /*
+     * \brief Continue parsing the frame at the start of \var data with all bytes received so far.
+     *        \var data may move between the calls (e.g. a growing vector), but the bytes already
+     *        passed must not change. The completed top level values are appended to \var values,
+     *        their data points into \var data (zero copy) and is only valid until \var data changes.
+     *        The values of a frame with a CRC are returned before the CRC is checked; if the check
+     *        fails at the end of the frame RSCP::ERR_INVALID_CRC is returned.
+     *        After the frame is complete or an error occurred the parser starts with a new frame.
+     * @param data   - Pointer to the first byte of the frame
+     * @param length - Number of bytes of the frame received so far (may include following frames)
+     * @param values - Vector the new complete values are appended to
+     * @return       - RSCP error code if the frame is invalid, 0 if the frame is not complete yet
+     *                 or the length of the complete frame in bytes (without padding)
+     */
+	int32_t parse(const uint8_t * data, uint32_t length, std::vector<SRscpValue> & values);
+    /*
+     * \brief Header of the current frame resp. the last complete frame, valid as soon as the first values are returned.
+     */
+	const SRscpFrameHeader & getHeader() const {
+		return header;
+	}
+
+private:
+	enum eState {
+		eStateHeader,   // waiting for the frame header
+		eStateValues,   // returning the top level values
+		eStateCRC       // waiting for the CRC behind the values
+	};
+
+	RscpProtocol protocol;
+	eState state;
+	SRscpFrameHeader header;
+	uint32_t frameLength;   // length of the frame including header and CRC
+	uint32_t valuePos;      // start of the next value, from the start of the frame
+	uint32_t crcPos;        // number of bytes already in uCRC32
+	uint32_t uCRC32;        // running CRC of header and values
+};
+
+#endif /* RSCPFRAMEPARSER_H_ */
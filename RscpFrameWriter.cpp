@@ -0,0 +1,90 @@
+//============================================================================
+// Name        : RscpFrameWriter.cpp
+// Description : Builds a RSCP frame in one pass
+//============================================================================
+
+#include "RscpFrameWriter.h"
+
+// size of a value without its data (tag, data type and length)
+#define VALUE_HEADER_SIZE   (sizeof(SRscpValue) - sizeof(((SRscpValue *) 0)->data))
+// the same limit as RscpProtocol::appendValue
+#define MAX_DATA_LENGTH     0xFFF8
+
+RscpFrameWriter::RscpFrameWriter(std::vector<uint8_t> & frameBuffer) : buffer(frameBuffer), pos(0) {
+	reset();
+}
+
+void RscpFrameWriter::reset() {
+	// the values start behind the frame header
+	pos = sizeof(SRscpFrameHeader);
+	containers.clear();
+}
+
+int32_t RscpFrameWriter::grow(size_t length) {
+	if((pos - sizeof(SRscpFrameHeader)) + length > MAX_DATA_LENGTH) {
+		return RSCP::ERR_DATA_LIMIT_EXCEEDED;
+	}
+	// only allocates if the buffer never held a frame of this size
+	if(buffer.size() < pos + length) {
+		buffer.resize(pos + length);
+	}
+	return RSCP::OK;
+}
+
+int32_t RscpFrameWriter::openContainer(const SRscpTag & tag) {
+	int32_t iResult = grow(VALUE_HEADER_SIZE);
+	if(iResult != RSCP::OK) {
+		return iResult;
+	}
+	SRscpValue *newData = reinterpret_cast<SRscpValue *>(&buffer[pos]);
+	newData->tag = tag;
+	newData->dataType = RSCP::eTypeContainer;
+	// set by closeContainer()
+	newData->length = 0;
+	containers.push_back(pos);
+	pos += VALUE_HEADER_SIZE;
+	return RSCP::OK;
+}
+
+int32_t RscpFrameWriter::closeContainer() {
+	if(containers.empty()) {
+		return RSCP::ERR_INVALID_INPUT;
+	}
+	size_t start = containers.back();
+	containers.pop_back();
+	// back-patch the length, the limit of the frame also limits the container
+	SRscpValue *container = reinterpret_cast<SRscpValue *>(&buffer[start]);
+	container->length = (uint16_t) (pos - start - VALUE_HEADER_SIZE);
+	return RSCP::OK;
+}
+
+int32_t RscpFrameWriter::appendValue(const SRscpTag & tag, const uint8_t * data, const uint16_t & dataLength, const uint8_t & dataType) {
+	if((data == NULL) && (dataLength > 0)) {
+		return RSCP::ERR_INVALID_INPUT;
+	}
+	int32_t iResult = grow(VALUE_HEADER_SIZE + dataLength);
+	if(iResult != RSCP::OK) {
+		return iResult;
+	}
+	SRscpValue *newData = reinterpret_cast<SRscpValue *>(&buffer[pos]);
+	newData->tag = tag;
+	newData->dataType = dataType;
+	newData->length = dataLength;
+	// copy into the position of the data pointer and not into the data pointer itself as the data is appended
+	if(dataLength > 0) {
+		memcpy(&newData->data, data, dataLength);
+	}
+	pos += VALUE_HEADER_SIZE + dataLength;
+	return RSCP::OK;
+}
+
+int32_t RscpFrameWriter::finishFrame(RscpProtocol & protocol, bool calcCRC, uint32_t alignment) {
+	if(!containers.empty()) {
+		return RSCP::ERR_INVALID_INPUT;
+	}
+	// the frame header has to exist even without any values
+	if(buffer.size() < pos) {
+		buffer.resize(pos);
+	}
+	return protocol.finishFrameInBuffer(buffer, getDataLength(), calcCRC, alignment);
+}
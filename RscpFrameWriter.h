@@ -0,0 +1,147 @@
+//============================================================================
+// Name        : RscpFrameWriter.h
+// Description : Builds a RSCP frame in one pass. The values are written one
+//             : after the other behind the frame header, containers get
+//             : their length when they are closed. Nothing is copied twice
+//             : and no value needs its own memory.
+//============================================================================
+
+#ifndef RSCPFRAMEWRITER_H_
+#define RSCPFRAMEWRITER_H_
+
+#include <vector>
+#include <string>
+#include <string.h>
+#include "RscpTypes.h"
+#include "RscpProtocol.h"
+
+/*
+ * Usage:
+ *   RscpFrameWriter writer(frameBuffer);
+ *   writer.openContainer(TAG_RSCP_REQ_AUTHENTICATION);
+ *   writer.appendValue(TAG_RSCP_AUTHENTICATION_USER, user);
+ *   writer.closeContainer();
+ *   writer.finishFrame(protocol, true, AES_BLOCK_SIZE);
+ * The frameBuffer then holds the padded frame like after RscpProtocol::createFrameInBuffer().
+ */
+class RscpFrameWriter {
+public:
+    /*
+     * Constructor
+     * @param frameBuffer - Buffer the frame is written to. It grows as needed and keeps its capacity,
+     *                      so a buffer that is reused for many frames does not allocate any more.
+     */
+	RscpFrameWriter(std::vector<uint8_t> & frameBuffer);
+    /*
+     * \brief Start a new frame, all values and open containers are dropped.
+     */
+	void reset();
+    /*
+     * \brief Write the header of a container value. All following values are inside the container
+     *        until closeContainer() is called. Containers can be nested.
+     * @param tag - TAG number of the container
+     * @return    - RSCP error code if the function fails else RSCP::OK
+     */
+	int32_t openContainer(const SRscpTag & tag);
+    /*
+     * \brief Close the innermost open container and set its length.
+     * @return - RSCP::ERR_INVALID_INPUT if no container is open else RSCP::OK
+     */
+	int32_t closeContainer();
+    /*
+     * \brief Number of open containers.
+     */
+	size_t getDepth() const {
+		return containers.size();
+	}
+    /*
+     * \brief Length of all values written so far in bytes (the dataLength of the frame).
+     */
+	uint16_t getDataLength() const {
+		return (uint16_t) (pos - sizeof(SRscpFrameHeader));
+	}
+    /*
+     * \brief The appendValue functions write one value like RscpProtocol::appendValue(), into the innermost
+     *        open container or at the top level of the frame. The values of a frame must not exceed
+     *        0xFFF8 bytes in total, otherwise RSCP::ERR_DATA_LIMIT_EXCEEDED is returned and nothing is written.
+     *        This is also returned for a string that does not fit into the 16 bit length of a value.
+     */
+	int32_t appendValue(const SRscpTag & tag) {
+		return appendValue(tag, NULL, 0, RSCP::eTypeNone);
+	}
+	int32_t appendValue(const SRscpTag & tag, const bool & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeBool);
+	}
+	int32_t appendValue(const SRscpTag & tag, const char & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeChar8);
+	}
+	int32_t appendValue(const SRscpTag & tag, const int8_t & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeChar8);
+	}
+	int32_t appendValue(const SRscpTag & tag, const uint8_t & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeUChar8);
+	}
+	int32_t appendValue(const SRscpTag & tag, const int16_t & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeInt16);
+	}
+	int32_t appendValue(const SRscpTag & tag, const uint16_t & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeUInt16);
+	}
+	int32_t appendValue(const SRscpTag & tag, const int32_t & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeInt32);
+	}
+	int32_t appendValue(const SRscpTag & tag, const uint32_t & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeUInt32);
+	}
+	int32_t appendValue(const SRscpTag & tag, const int64_t & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeInt64);
+	}
+	int32_t appendValue(const SRscpTag & tag, const uint64_t & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeUInt64);
+	}
+	int32_t appendValue(const SRscpTag & tag, const float & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeFloat32);
+	}
+	int32_t appendValue(const SRscpTag & tag, const double & value) {
+		return appendValue(tag, (uint8_t *) &value, sizeof(value), RSCP::eTypeDouble64);
+	}
+	int32_t appendValue(const SRscpTag & tag, const char * value) {
+		return appendString(tag, value, strlen(value));
+	}
+	int32_t appendValue(const SRscpTag & tag, const std::string & value) {
+		return appendString(tag, value.c_str(), value.size());
+	}
+	int32_t appendValue(const SRscpTag & tag, const SRscpTimestamp & timestamp) {
+		return appendValue(tag, (uint8_t *) &timestamp, sizeof(timestamp), RSCP::eTypeTimestamp);
+	}
+	int32_t appendValue(const SRscpTag & tag, const uint8_t * value, const uint16_t & dataLength) {
+		return appendValue(tag, value, dataLength, RSCP::eTypeByteArray);
+	}
+	int32_t appendValue(const SRscpTag & tag, const uint8_t * data, const uint16_t & dataLength, const uint8_t & dataType);
+    /*
+     * \brief Write the frame header and CRC and pad the frame, see RscpProtocol::finishFrameInBuffer().
+     *        All containers must be closed. Call reset() before the next frame is written.
+     * @param protocol  - Protocol object that sets the header
+     * @param calcCRC   - If set TRUE the CRC for the frame is calculated and appended to the frame.
+     * @param alignment - The padded frame length is a multiple of this value (1 = no padding)
+     * @return          - RSCP error code if the function fails else RSCP::OK
+     */
+	int32_t finishFrame(RscpProtocol & protocol, bool calcCRC, uint32_t alignment);
+
+private:
+	// make room for length more bytes behind pos, checks the frame limit
+	int32_t grow(size_t length);
+	// a string value, the length is checked before it is cut to 16 bits
+	int32_t appendString(const SRscpTag & tag, const char * value, size_t length) {
+		if(length > 0xFFFF) {
+			return RSCP::ERR_DATA_LIMIT_EXCEEDED;
+		}
+		return appendValue(tag, (const uint8_t *) value, (uint16_t) length, RSCP::eTypeString);
+	}
+
+	std::vector<uint8_t> & buffer;
+	size_t pos;                     // end of the written values in buffer
+	std::vector<size_t> containers; // offsets of the open container headers
+};
+
+#endif /* RSCPFRAMEWRITER_H_ */
@@ -0,0 +1,109 @@
+//============================================================================
+// Name        : RscpHistory.cpp
+// Description : Decodes a history response into one column per tag
+//============================================================================
+
+#include <math.h>
+#include <string.h>
+#include "RscpHistory.h"
+#include "RscpContainer.h"
+
+RscpHistory::RscpHistory() {
+	clear();
+}
+
+void RscpHistory::clear() {
+	for (int c = 0; c < eHistoryColumnCount; c++) {
+		columns[c].clear();
+		sums[c] = NAN;
+	}
+	timestamps.clear();
+	bSum = false;
+	bError = false;
+	error = 0;
+	errorTag = 0;
+	unknownTags.clear();
+}
+
+eRscpHistoryColumn RscpHistory::findColumn(SRscpTag tag) {
+	for (int c = 0; c < eHistoryColumnCount; c++) {
+		if(rscpHistoryTags[c] == tag) {
+			return (eRscpHistoryColumn) c;
+		}
+	}
+	return eHistoryColumnCount;
+}
+
+void RscpHistory::decodeRow(const SRscpValue & container, float * row) {
+	for (int c = 0; c < eHistoryColumnCount; c++) {
+		row[c] = NAN;
+	}
+	// the S10 sends the tags in the order of the columns, so the next column is tried first
+	int next = 0;
+	for (const SRscpValue & value : RscpContainerRange(&container)) {
+		int c = next;
+		if((c == eHistoryColumnCount) || (rscpHistoryTags[c] != value.tag)) {
+			c = findColumn(value.tag);
+		}
+		if(c == eHistoryColumnCount) {
+			unknownTags.push_back(value.tag);
+			continue;
+		}
+		// a value of another type or length counts as missing
+		if((value.dataType == RSCP::eTypeFloat32) && (value.length == sizeof(float))) {
+			memcpy(&row[c], value.data, sizeof(float));
+		}
+		next = c + 1;
+	}
+}
+
+int32_t RscpHistory::decode(const SRscpValue * history, int64_t start, int64_t interval) {
+	clear();
+	if((history == NULL) || (history->dataType != RSCP::eTypeContainer)) {
+		return RSCP::ERR_INVALID_INPUT;
+	}
+	// count the intervals first, every column is allocated once
+	size_t count = 0;
+	for (const SRscpValue & value : RscpContainerRange(history)) {
+		if(value.dataType == RSCP::eTypeError) {
+			break;
+		}
+		if((value.tag == TAG_DB_VALUE_CONTAINER) && (value.dataType == RSCP::eTypeContainer)) {
+			count++;
+		}
+	}
+	for (int c = 0; c < eHistoryColumnCount; c++) {
+		columns[c].assign(count, NAN);
+	}
+	timestamps.resize(count);
+
+	size_t i = 0;
+	float row[eHistoryColumnCount];
+	for (const SRscpValue & value : RscpContainerRange(history)) {
+		if(value.dataType == RSCP::eTypeError) {
+			// the rest of the container is not valid
+			bError = true;
+			if(value.length > 0) {
+				memcpy(&error, value.data, (value.length < sizeof(error)) ? value.length : sizeof(error));
+			}
+			errorTag = value.tag;
+			break;
+		}
+		if((value.tag == TAG_DB_VALUE_CONTAINER) && (value.dataType == RSCP::eTypeContainer)) {
+			decodeRow(value, row);
+			for (int c = 0; c < eHistoryColumnCount; c++) {
+				columns[c][i] = row[c];
+			}
+			timestamps[i] = start + (int64_t) i * interval;
+			i++;
+		}
+		else if((value.tag == TAG_DB_SUM_CONTAINER) && (value.dataType == RSCP::eTypeContainer)) {
+			decodeRow(value, sums);
+			bSum = true;
+		}
+		else {
+			unknownTags.push_back(value.tag);
+		}
+	}
+	return count;
+}
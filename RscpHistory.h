@@ -0,0 +1,136 @@
+//============================================================================
+// Name        : RscpHistory.h
+// Description : Decodes a whole TAG_DB_HISTORY_DATA_* response into columns:
+//             : one contiguous float array per tag of the value containers
+//             : and one with the start time of each interval. Values that
+//             : are missing in an interval are NaN.
+//============================================================================
+
+#ifndef RSCPHISTORY_H_
+#define RSCPHISTORY_H_
+
+#include <vector>
+#include "RscpTypes.h"
+#include "RscpTags.h"
+
+// the columns, one per tag of a TAG_DB_VALUE_CONTAINER resp. TAG_DB_SUM_CONTAINER
+enum eRscpHistoryColumn {
+	eHistoryGraphIndex,
+	eHistoryBatPowerIn,
+	eHistoryBatPowerOut,
+	eHistoryDCPower,
+	eHistoryGridPowerIn,
+	eHistoryGridPowerOut,
+	eHistoryConsumption,
+	eHistoryPM0Power,
+	eHistoryPM1Power,
+	eHistoryBatChargeLevel,
+	eHistoryBatCycleCount,
+	eHistoryConsumedProduction,
+	eHistoryAutarky,
+	eHistoryColumnCount
+};
+
+// tag of each column
+constexpr SRscpTag rscpHistoryTags[eHistoryColumnCount] = {
+	TAG_DB_GRAPH_INDEX,
+	TAG_DB_BAT_POWER_IN,
+	TAG_DB_BAT_POWER_OUT,
+	TAG_DB_DC_POWER,
+	TAG_DB_GRID_POWER_IN,
+	TAG_DB_GRID_POWER_OUT,
+	TAG_DB_CONSUMPTION,
+	TAG_DB_PM_0_POWER,
+	TAG_DB_PM_1_POWER,
+	TAG_DB_BAT_CHARGE_LEVEL,
+	TAG_DB_BAT_CYCLE_COUNT,
+	TAG_DB_CONSUMED_PRODUCTION,
+	TAG_DB_AUTARKY,
+};
+
+class RscpHistory {
+public:
+	RscpHistory();
+    /*
+     * \brief Decode all value containers and the sum container of \var history. The previous content is
+     *        dropped, the memory of the columns is kept for the next response. The data of \var history
+     *        is only read while decoding, it may be a zero copy value of the receive buffer.
+     *        An error value inside the container ends the decoding, see getError().
+     * @param history  - TAG_DB_HISTORY_DATA_DAY, _MONTH or _YEAR container
+     * @param start    - Start of the first interval in seconds (TAG_DB_REQ_HISTORY_TIME_START)
+     * @param interval - Length of an interval in seconds (TAG_DB_REQ_HISTORY_TIME_INTERVAL)
+     * @return         - RSCP error code if \var history is no container or the number of intervals
+     */
+	int32_t decode(const SRscpValue * history, int64_t start, int64_t interval);
+    /*
+     * \brief Drop all intervals and the sum.
+     */
+	void clear();
+    /*
+     * \brief Number of intervals (TAG_DB_VALUE_CONTAINER) decoded, the length of every column.
+     */
+	size_t size() const {
+		return timestamps.size();
+	}
+    /*
+     * \brief The values of \var column for all intervals, NaN where the interval did not have the tag.
+     */
+	const float * getColumn(eRscpHistoryColumn column) const {
+		return columns[column].data();
+	}
+	float getValue(eRscpHistoryColumn column, size_t interval) const {
+		return columns[column][interval];
+	}
+    /*
+     * \brief Start time in seconds of every interval.
+     */
+	const int64_t * getTimestamps() const {
+		return timestamps.data();
+	}
+    /*
+     * \brief The TAG_DB_SUM_CONTAINER of the response, all NaN if there was none.
+     */
+	bool hasSum() const {
+		return bSum;
+	}
+	float getSum(eRscpHistoryColumn column) const {
+		return sums[column];
+	}
+    /*
+     * \brief Whether the history container held an error value (e.g. access denied), its code and tag.
+     */
+	bool hasError() const {
+		return bError;
+	}
+	uint32_t getError() const {
+		return error;
+	}
+	SRscpTag getErrorTag() const {
+		return errorTag;
+	}
+    /*
+     * \brief Tags in the response that have no column, in the order received.
+     */
+	const std::vector<SRscpTag> & getUnknownTags() const {
+		return unknownTags;
+	}
+    /*
+     * \brief Column of \var tag or eHistoryColumnCount if the tag has no column.
+     */
+	static eRscpHistoryColumn findColumn(SRscpTag tag);
+
+private:
+	// read the values of a value or sum container into \var row (eHistoryColumnCount floats), NaN if missing
+	void decodeRow(const SRscpValue & container, float * row);
+
+	std::vector<float> columns[eHistoryColumnCount];
+	std::vector<int64_t> timestamps;
+	float sums[eHistoryColumnCount];
+	bool bSum;
+	bool bError;
+	uint32_t error;
+	SRscpTag errorTag;
+	std::vector<SRscpTag> unknownTags;
+};
+
+#endif /* RSCPHISTORY_H_ */
@@ -11,9 +11,10 @@
 #include <windows.h>
 #endif
 #include "RscpProtocol.h"
+#include "RscpCRC32.h"
 
 
-RscpProtocol::RscpProtocol() {
+RscpProtocol::RscpProtocol(RscpArena * arena) : arena(arena) {
 }
 
 RscpProtocol::~RscpProtocol() {
@@ -52,19 +53,13 @@ bool RscpProtocol::setHeaderTimestamp(SRscpFrame *frame) {
 	return bTimeSet;
 }
 
-uint32_t RscpProtocol::calculateCRC32(const uint8_t *data, uint16_t length) {
-    static const uint32_t crc_table[] = {
-      0x4DBDF21C, 0x500AE278, 0x76D3D2D4, 0x6B64C2B0,
-      0x3B61B38C, 0x26D6A3E8, 0x000F9344, 0x1DB88320,
-      0xA005713C, 0xBDB26158, 0x9B6B51F4, 0x86DC4190,
-      0xD6D930AC, 0xCB6E20C8, 0xEDB71064, 0xF0000000
-    };
-	uint32_t crc = 0;
-    for(uint32_t n = 0; n < length; n++) {
-        crc = (crc >> 4) ^ crc_table[(crc ^ (data[n] >> 0)) & 0x0F];  /* lower nibble */
-        crc = (crc >> 4) ^ crc_table[(crc ^ (data[n] >> 4)) & 0x0F];  /* upper nibble */
-	}
-	return crc;
+uint32_t RscpProtocol::calculateCRC32(const uint8_t *data, uint32_t length) {
+	return updateCRC32(0, data, length);
+}
+
+uint32_t RscpProtocol::updateCRC32(uint32_t crc, const uint8_t *data, uint32_t length) {
+	// slicing-by-8 or PCLMULQDQ, selected once for the CPU
+	return RscpCRC32_Update(crc, data, length);
 }
 
 int32_t RscpProtocol::getFrameLength(const uint8_t * data, const uint32_t & length) {
@@ -125,6 +120,77 @@ int32_t RscpProtocol::createFrameAsBuffer(SRscpFrameBuffer* frameBuffer, const u
 	return RSCP::OK;
 }
 
+int32_t RscpProtocol::createFrameInBuffer(std::vector<uint8_t> & frameBuffer, const uint8_t * data, uint16_t dataLength, bool calcCRC, uint32_t alignment) {
+	if((data == NULL) && (dataLength > 0)) {
+		return RSCP::ERR_INVALID_INPUT;
+	}
+	if(alignment == 0) {
+		alignment = 1;
+	}
+	// calculate the required frame size and the padded size
+	size_t sFrameSize = sizeof(SRscpFrameHeader) + dataLength + (calcCRC ? sizeof(uint32_t) : 0);
+	size_t sPaddedSize = ((sFrameSize + alignment - 1) / alignment) * alignment;
+	// only allocates if the buffer never held a frame of this size
+	frameBuffer.resize(sPaddedSize);
+	uint8_t * buffer = &frameBuffer[0];
+
+	setFrameHeader(buffer, dataLength, calcCRC);
+
+	// copy the data in small chunks and calculate the CRC of each chunk while it is still in the cache
+	uint32_t uCRC32 = calcCRC ? updateCRC32(0, buffer, sizeof(SRscpFrameHeader)) : 0;
+	uint8_t * dest = buffer + sizeof(SRscpFrameHeader);
+	for(uint32_t pos = 0; pos < dataLength; ) {
+		uint32_t chunk = (dataLength - pos < 256) ? (dataLength - pos) : 256;
+		memcpy(dest + pos, data + pos, chunk);
+		if(calcCRC) {
+			uCRC32 = updateCRC32(uCRC32, dest + pos, chunk);
+		}
+		pos += chunk;
+	}
+	// append the CRC and zero the padding
+	if(calcCRC) {
+		memcpy(dest + dataLength, &uCRC32, sizeof(uCRC32));
+	}
+	memset(buffer + sFrameSize, 0, sPaddedSize - sFrameSize);
+
+	return RSCP::OK;
+}
+
+int32_t RscpProtocol::finishFrameInBuffer(std::vector<uint8_t> & frameBuffer, uint16_t dataLength, bool calcCRC, uint32_t alignment) {
+	if(frameBuffer.size() < sizeof(SRscpFrameHeader) + dataLength) {
+		return RSCP::ERR_INVALID_INPUT;
+	}
+	if(alignment == 0) {
+		alignment = 1;
+	}
+	// calculate the required frame size and the padded size
+	size_t sFrameSize = sizeof(SRscpFrameHeader) + dataLength + (calcCRC ? sizeof(uint32_t) : 0);
+	size_t sPaddedSize = ((sFrameSize + alignment - 1) / alignment) * alignment;
+	// the data stays in place, only the CRC and the padding are added
+	frameBuffer.resize(sPaddedSize);
+	uint8_t * buffer = &frameBuffer[0];
+
+	setFrameHeader(buffer, dataLength, calcCRC);
+	if(calcCRC) {
+		uint32_t uCRC32 = calculateCRC32(buffer, sizeof(SRscpFrameHeader) + dataLength);
+		memcpy(buffer + sizeof(SRscpFrameHeader) + dataLength, &uCRC32, sizeof(uCRC32));
+	}
+	memset(buffer + sFrameSize, 0, sPaddedSize - sFrameSize);
+
+	return RSCP::OK;
+}
+
+void RscpProtocol::setFrameHeader(uint8_t * buffer, uint16_t dataLength, bool calcCRC) {
+	// set initial header values
+	memset(buffer, 0, sizeof(SRscpFrameHeader));
+	SRscpFrame* tmpFrame = reinterpret_cast<SRscpFrame*>(buffer);
+	tmpFrame->header.magic = RSCP::MAGIC;
+	tmpFrame->header.ctrl.bits.crc = calcCRC;
+	tmpFrame->header.ctrl.bits.version = RSCP::VERSION;
+	tmpFrame->header.dataLength = dataLength;
+	setHeaderTimestamp(tmpFrame);
+}
+
 int32_t RscpProtocol::createFrameAsBuffer(SRscpFrameBuffer* frame, const SRscpValue & data, bool calcCRC) {
 	// just overload the vector function
 	return createFrameAsBuffer(frame, std::vector<SRscpValue>(1, data), calcCRC);
@@ -281,12 +347,18 @@ bool RscpProtocol::allocateMemory(SRscpValue* value, size_t size)  {
 		if(size == 0) {
 			return true;
 		}
-		value->data = (uint8_t *) malloc(size);
+		value->data = (uint8_t *) ((arena != NULL) ? arena->allocate(size) : malloc(size));
 		return (value->data != NULL);
 	}
 	else {
 		// if data is already allocated -> reallocate to the correct size
-		uint8_t *ucTmp = (uint8_t *) realloc(value->data, size);
+		uint8_t *ucTmp;
+		if((arena != NULL) && arena->owns(value->data)) {
+			ucTmp = (uint8_t *) arena->reallocate(value->data, size);
+		}
+		else {
+			ucTmp = (uint8_t *) realloc(value->data, size);
+		}
 		if(ucTmp != NULL) {
 			value->data = ucTmp;
 			return true;
@@ -295,7 +367,7 @@ bool RscpProtocol::allocateMemory(SRscpValue* value, size_t size)  {
 	return false;
 }
 
-int32_t RscpProtocol::parseFrame(const uint8_t* data, const uint32_t & length, SRscpFrame* frame) {
+int32_t RscpProtocol::parseFrame(const uint8_t* data, const uint32_t & length, SRscpFrame* frame, bool bCopyData) {
 	// sanity check
 	if((data == NULL) || (frame == NULL)) {
 		return RSCP::ERR_INVALID_INPUT;
@@ -338,7 +410,7 @@ int32_t RscpProtocol::parseFrame(const uint8_t* data, const uint32_t & length, S
 	// copy header information
 	memcpy(&frame->header, &inFrame->header, sizeof(SRscpFrameHeader));
 	// parse the SRscpValues
-	int32_t iResult = parseData((uint8_t*)(&inFrame->header + 1), inFrame->header.dataLength, frame->data);
+	int32_t iResult = parseData((uint8_t*)(&inFrame->header + 1), inFrame->header.dataLength, frame->data, bCopyData);
 	if(iResult < 0) {
 		return iResult;
 	}
@@ -347,26 +419,31 @@ int32_t RscpProtocol::parseFrame(const uint8_t* data, const uint32_t & length, S
 	return frameLength;
 }
 
-int32_t RscpProtocol::parseData(const uint8_t* data, const uint32_t & length, std::vector<SRscpValue> & vecValues) {
+int32_t RscpProtocol::parseData(const uint8_t* data, const uint32_t & length, std::vector<SRscpValue> & vecValues, bool bCopyData) {
 	// sanity check
 	if(data == NULL) {
 		return RSCP::ERR_INVALID_INPUT;
 	}
 	// start parsing
+	const uint32_t uiHeaderSize = sizeof(SRscpValue) - sizeof(((SRscpValue *) 0)->data);
 	uint32_t uiPos = 0;
 	SRscpValue * value = reinterpret_cast<SRscpValue *>(((uint8_t*)data) + uiPos);
 
-	// check the boundaries of the buffer
-	while((uiPos < length) && ((uiPos + value->length) <= length)) {
+	// check the boundaries of the buffer, the header has to fit before its length is read
+	while((uiPos + uiHeaderSize <= length) && ((uiPos + uiHeaderSize + value->length) <= length)) {
 		// parse the data
 		SRscpValue newVal;
 		newVal.tag = value->tag;
 		newVal.dataType = value->dataType;
 		newVal.length = value->length;
-		if(value->length > 0) {
-			// allocate data memory for each value separately
-			newVal.data = (uint8_t *) malloc(value->length);
-			if(newVal.data == NULL) {
+		if((value->length > 0) && !bCopyData) {
+			// zero copy, the value points to its data inside the buffer
+			newVal.data = (uint8_t *) &value->data;
+		}
+		else if(value->length > 0) {
+			// allocate data memory for each value separately (from the arena if set)
+			newVal.data = NULL;
+			if(allocateMemory(&newVal, value->length) == false) {
 				// not enough memory, return only what parsed until now
 				destroyValueData(vecValues);
 				return RSCP::ERR_NO_MEMORY;
@@ -388,6 +465,85 @@ int32_t RscpProtocol::parseData(const uint8_t* data, const uint32_t & length, st
 	return uiPos;
 }
 
+int32_t RscpProtocol::visitData(const uint8_t* data, const uint32_t & length, RscpVisitor & visitor) {
+	// sanity check
+	if((data == NULL) && (length > 0)) {
+		return RSCP::ERR_INVALID_INPUT;
+	}
+	const uint32_t uiHeaderSize = sizeof(SRscpValue) - sizeof(((SRscpValue *) 0)->data);
+	// the open containers, innermost last
+	struct {
+		SRscpValue value;
+		uint32_t end;
+	} containers[RSCP_MAX_VISIT_DEPTH];
+	uint32_t depth = 0;
+	uint32_t uiPos = 0;
+
+	while(true) {
+		// leave all containers that end here
+		while((depth > 0) && (uiPos >= containers[depth - 1].end)) {
+			depth--;
+			visitor.leaveContainer(containers[depth].value);
+		}
+		uint32_t uiEnd = (depth > 0) ? containers[depth - 1].end : length;
+		// check the boundaries of the buffer resp. the container
+		const SRscpValue * value = reinterpret_cast<const SRscpValue *>(data + uiPos);
+		if((uiPos + uiHeaderSize > uiEnd) || (uiPos + uiHeaderSize + value->length > uiEnd)) {
+			if(depth == 0) {
+				break;
+			}
+			// ignore the rest of the container like parseData()
+			uiPos = uiEnd;
+			continue;
+		}
+		SRscpValue newVal;
+		newVal.tag = value->tag;
+		newVal.dataType = value->dataType;
+		newVal.length = value->length;
+		newVal.data = (value->length > 0) ? (uint8_t *) &value->data : NULL;
+		uint32_t uiNext = uiPos + uiHeaderSize + value->length;
+
+		if(newVal.dataType == RSCP::eTypeContainer) {
+			if(depth == RSCP_MAX_VISIT_DEPTH) {
+				return RSCP::ERR_DATA_LIMIT_EXCEEDED;
+			}
+			if(visitor.enterContainer(newVal)) {
+				// continue with the first value inside the container
+				containers[depth].value = newVal;
+				containers[depth].end = uiNext;
+				depth++;
+				uiPos += uiHeaderSize;
+				continue;
+			}
+		}
+		else {
+			visitor.value(newVal);
+		}
+		uiPos = uiNext;
+	}
+
+	return uiPos;
+}
+
+int32_t RscpProtocol::visitValue(const SRscpValue* value, RscpVisitor & visitor) {
+	// sanity check
+	if(value == NULL) {
+		return RSCP::ERR_INVALID_INPUT;
+	}
+	if(value->dataType != RSCP::eTypeContainer) {
+		visitor.value(*value);
+		return RSCP::OK;
+	}
+	if(visitor.enterContainer(*value)) {
+		int32_t iResult = visitData(value->data, value->length, visitor);
+		if(iResult < 0) {
+			return iResult;
+		}
+		visitor.leaveContainer(*value);
+	}
+	return RSCP::OK;
+}
+
 std::string RscpProtocol::getValueAsString(const SRscpValue* value) {
 	// sanity check
 	std::string strValue;
@@ -583,7 +739,10 @@ int32_t RscpProtocol::destroyValueData(SRscpValue * value) {
 		return RSCP::ERR_INVALID_INPUT;
 	}
 	if(value->data != NULL) {
-		free(value->data);
+		// arena memory is released with RscpArena::reset()
+		if((arena == NULL) || !arena->owns(value->data)) {
+			free(value->data);
+		}
 		value->data = NULL;
 	}
 	return RSCP::OK;
@@ -12,17 +12,102 @@
 #include <string>
 #include <string.h>
 #include "RscpTypes.h"
+#include "RscpArena.h"
+#include "RscpTagSchema.h"
+
+// deepest container nesting RscpProtocol::visitData() follows
+#define RSCP_MAX_VISIT_DEPTH        32
+
+/*
+ * Callbacks of RscpProtocol::visitData(). The values passed point into the visited buffer (zero copy)
+ * and are only valid during the call.
+ */
+class RscpVisitor {
+public:
+	virtual ~RscpVisitor() {}
+    /*
+     * \brief Called for a container value before its content.
+     * @return TRUE to visit the content and get leaveContainer(), FALSE to skip the container
+     */
+	virtual bool enterContainer(const SRscpValue & container) {
+		return true;
+	}
+    /*
+     * \brief Called for every value that is not a container.
+     */
+	virtual void value(const SRscpValue & value) = 0;
+    /*
+     * \brief Called after the content of a container that was entered.
+     */
+	virtual void leaveContainer(const SRscpValue & container) {
+	}
+};
+
+/*
+ * C++ type of the values of a RSCP::eRscpDataType, used by RscpProtocol::get<TAG>().
+ * Only data types with a single value are valid.
+ */
+template <uint8_t DATATYPE> struct RscpDataTypeTraits {
+	static const bool valid = false;
+	typedef uint8_t type;
+};
+#define RSCP_DATA_TYPE_TRAITS(dataType, cType) \
+	template <> struct RscpDataTypeTraits<dataType> { \
+		static const bool valid = true; \
+		typedef cType type; \
+	};
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeBool, bool)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeChar8, int8_t)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeUChar8, uint8_t)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeInt16, int16_t)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeUInt16, uint16_t)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeInt32, int32_t)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeUInt32, uint32_t)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeInt64, int64_t)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeUInt64, uint64_t)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeFloat32, float)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeDouble64, double)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeString, std::string)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeTimestamp, SRscpTimestamp)
+RSCP_DATA_TYPE_TRAITS(RSCP::eTypeError, uint32_t)
+#undef RSCP_DATA_TYPE_TRAITS
+
+/*
+ * C++ type of the value of \var TAG from RscpTagSchema, checked at compile time.
+ */
+template <SRscpTag TAG> struct RscpTagType {
+	static_assert(RscpTagSchema::find(TAG) != NULL, "the tag is not in RscpTags.h");
+	static_assert(RscpTagSchema::dataType(TAG) != RSCP_TYPE_UNKNOWN, "the data type of the tag is not known, add it to gen_tag_schema.py");
+	static_assert(RscpDataTypeTraits<RscpTagSchema::dataType(TAG)>::valid, "the tag has no single value (e.g. a container)");
+	typedef typename RscpDataTypeTraits<RscpTagSchema::dataType(TAG)>::type type;
+};
 
 class RscpProtocol {
 public:
     /*
      * Constructor
+     * @param arena - Optional arena that serves the payload memory of all values, see setArena()
      */
-	RscpProtocol();
+	RscpProtocol(RscpArena * arena = NULL);
     /*
      * Destructor
      */
 	virtual ~RscpProtocol();
+    /*
+     * \brief Serve the payload memory of parsed and created values from \var arena instead of the heap.
+     *        destroyValueData() and destroyFrameData() do not free arena memory; the owner releases
+     *        all payloads of a frame at once with RscpArena::reset(). Values must not be used after the reset.
+     * @param arena - Arena to use or NULL to allocate from the heap again
+     */
+	void setArena(RscpArena * arena) {
+		this->arena = arena;
+	}
+    /*
+     * \brief Get the arena set with setArena() or NULL.
+     */
+	RscpArena * getArena() const {
+		return arena;
+	}
     /*
      * \brief Function to get the total expected length that the frame buffer inside \var data should have (not has).
      *        This function also validates the MAGIC and VERSION of the frame. The frame inside the \var data buffer
@@ -73,6 +158,29 @@ public:
      * @return	      - RSCP error code if the function fails else RSCP::OK
      */
     int32_t createFrameAsBuffer(SRscpFrameBuffer *frameBuffer, const SRscpFrame & frame, bool calcCRC);
+    /*
+     * \brief Create a RSCP frame directly inside the reusable \var frameBuffer, ready for in place encryption.
+     *        The CRC is calculated while the data is copied and the frame is zero padded to a multiple of
+     *        \var alignment bytes (e.g. the AES block size). The vector keeps its capacity, so sending
+     *        with the same buffer again does not allocate any memory.
+     * @param frameBuffer - Buffer for the frame, resized to the padded frame length
+     * @param data        - Pointer to the first RSCP value struct in line.
+     * @param dataLength  - Data length of the data buffer in bytes.
+     * @param calcCRC     - If set TRUE the CRC for the frame is calculated and appended to the frame.
+     * @param alignment   - The padded frame length is a multiple of this value (1 = no padding)
+     * @return	          - RSCP error code if the function fails else RSCP::OK
+     */
+    int32_t createFrameInBuffer(std::vector<uint8_t> & frameBuffer, const uint8_t * data, uint16_t dataLength, bool calcCRC, uint32_t alignment);
+    /*
+     * \brief Complete a RSCP frame whose values were already written behind the header space of \var frameBuffer,
+     *        e.g. by RscpFrameWriter. Sets the header, appends the CRC and pads like createFrameInBuffer().
+     * @param frameBuffer - Buffer with \var dataLength bytes of values at offset sizeof(SRscpFrameHeader)
+     * @param dataLength  - Data length of the values in bytes.
+     * @param calcCRC     - If set TRUE the CRC for the frame is calculated and appended to the frame.
+     * @param alignment   - The padded frame length is a multiple of this value (1 = no padding)
+     * @return	          - RSCP error code if the function fails else RSCP::OK
+     */
+    int32_t finishFrameInBuffer(std::vector<uint8_t> & frameBuffer, uint16_t dataLength, bool calcCRC, uint32_t alignment);
     /*
      * \brief Create a RSCP frame from one single RscpValue struct into the pre-allocated \var frame.
      * 		  The user is responsible to free the memory of \var frame with RscpProtocol::destroyFrameData().
@@ -95,24 +203,31 @@ public:
      * \brief Function to parse raw frame data from \var data of length \var length
      * 		  into the preallocated struct \var frame.
      * 		  The user is responsible to free the memory of \var frame with RscpProtocol::destroyFrameData().
+     * 		  If \var bCopyData is FALSE no memory is allocated for the values, their data pointers point
+     * 		  into \var data instead. These values are only valid as long as \var data is not changed
+     * 		  and must not be passed to destroyFrameData() or destroyValueData().
      * @param data		- Pointer to the raw data frame buffer
      * @param length	- Length of data in bytes
      * @param frame		- Frame buffer into which the data is parsed (should be != NULL)
+     * @param bCopyData - TRUE to copy the data of each value, FALSE to point into \var data (zero copy)
      * @return			- RSCP error code if the function fails or processed amount of bytes on success
      */
-	int32_t parseFrame(const uint8_t* data, const uint32_t & length, SRscpFrame* frame);
+	int32_t parseFrame(const uint8_t* data, const uint32_t & length, SRscpFrame* frame, bool bCopyData = true);
     /*
      * \brief Function to parse raw tag data from \var data of length \var length
      * 		  and return a vector of tags.
      * 		  The user is responsible to free the memory of \var frameData with RscpProtocol::destroyValueData().
+     * 		  With \var bCopyData FALSE the values point into \var data, see parseFrame().
      * @param data		- Pointer to the raw data frame buffer
      * @param length	- Length of data in bytes
      * @param frameData - Reference to a data vector of SRscpValues
+     * @param bCopyData - TRUE to copy the data of each value, FALSE to point into \var data (zero copy)
      * @return			- RSCP error code if the function fails or processed amount of bytes on success
      */
-    int32_t parseData(const uint8_t* data, const uint32_t & length, std::vector<SRscpValue> & frameData);
+    int32_t parseData(const uint8_t* data, const uint32_t & length, std::vector<SRscpValue> & frameData, bool bCopyData = true);
 	/*
 	 * \biref This function allocates memory of size \var size. If data is already allocated it will reallocate the requested size.
+	 *        The memory is taken from the arena if one is set.
 	 * @param value  - Pointer to the RSCP value struct.
 	 * @param size   - The buffer size that is required
 	 * @return TRUE if data was allocated otherwise false.
@@ -480,17 +595,48 @@ public:
 	 * \copydoc RscpProtocol::getValueAsBool(const SRscpValue* value)
 	 */
     std::string getValueAsString(const SRscpValue* value);
+    /*
+     * \brief Get \var value as the data type of \var TAG in RscpTagSchema, e.g. get<TAG_EMS_POWER_PV>(value) returns
+     *        an int32_t. Tags without a known single value type do not compile.
+     * @param value - The pointer to a struct RSCP with the tag \var TAG.
+     * @return		- The value in the data type of the tag.
+     */
+    template <SRscpTag TAG>
+    typename RscpTagType<TAG>::type get(const SRscpValue* value) {
+    	return getTyped(value, (typename RscpTagType<TAG>::type *) NULL);
+    }
     /*
      * \brief Function get \var value as a container type. It returns all the SRscpValue structs from the container.
      * 		  The user is responsible to free the memory of the vector<SRscpValue> with RscpProtocol::destroyValueData().
-     * @param data - RSCP value struct
-     * @return     - Vector with all rscp value structs found in the container. Empty on failure and no or invalid data.
-     */
-    std::vector<SRscpValue> getValueAsContainer(const SRscpValue* value) {
+     * 		  With \var bCopyData FALSE the values point into the data of \var value and need not be freed,
+     * 		  they are valid as long as the data of \var value (e.g. the receive buffer of a zero copy frame).
+     * 		  RscpContainerRange (RscpContainer.h) walks the values in place without the vector.
+     * @param data      - RSCP value struct
+     * @param bCopyData - TRUE to copy the data of each value, FALSE to point into \var value (zero copy)
+     * @return          - Vector with all rscp value structs found in the container. Empty on failure and no or invalid data.
+     */
+    std::vector<SRscpValue> getValueAsContainer(const SRscpValue* value, bool bCopyData = true) {
     	std::vector<SRscpValue> dataValues;
-    	parseData(value->data, value->length, dataValues);
+    	parseData(value->data, value->length, dataValues, bCopyData);
     	return dataValues;
     }
+    /*
+     * \brief Walk the raw tag data \var data of length \var length once and pass every value to \var visitor,
+     *        depth first. Containers are not copied or collected in vectors, nested containers are followed
+     *        up to RSCP_MAX_VISIT_DEPTH levels. Invalid lengths end the walk like in parseData().
+     * @param data    - Pointer to the first RSCP value struct in line (e.g. the data of a frame)
+     * @param length  - Length of data in bytes
+     * @param visitor - Callbacks for the values
+     * @return        - RSCP error code if the function fails or processed amount of bytes on success
+     */
+    int32_t visitData(const uint8_t* data, const uint32_t & length, RscpVisitor & visitor);
+    /*
+     * \brief Pass \var value to \var visitor like visitData(), a container with all of its content.
+     * @param value   - RSCP value struct, e.g. one value of a parsed frame
+     * @param visitor - Callbacks for the values
+     * @return        - RSCP error code if the function fails else RSCP::OK
+     */
+    int32_t visitValue(const SRscpValue* value, RscpVisitor & visitor);
     /*
      * \brief This function destroys all allocated data inside a RSCP value.
      * @param  - Pointer to the RSCP value.
@@ -543,13 +689,38 @@ private:
      * @param - Length of the buffer data
      * @return The calculated CRC32 value is returned.
      */
-    uint32_t calculateCRC32(const uint8_t *data, uint16_t length);
+    uint32_t calculateCRC32(const uint8_t *data, uint32_t length);
+    /*
+     * \brief Continue the CRC32 \var crc of the preceding bytes over \var length more bytes.
+     *        calculateCRC32(data, n) is the same as updateCRC32(0, data, n).
+     * @param - CRC32 of the preceding bytes, 0 for the first bytes
+     * @param - Pointer to a data buffer
+     * @param - Length of the buffer data
+     * @return The CRC32 of all bytes so far.
+     */
+    uint32_t updateCRC32(uint32_t crc, const uint8_t *data, uint32_t length);
     /*
      * \brief This function sets the current time in seconds and nanoseconds to the frame.
      * @param - Pointer to an rscp frame object.
      * @return True on success else false.
      */
     bool setHeaderTimestamp(SRscpFrame *frame);
+    /*
+     * \brief Write the frame header for \var dataLength bytes of values to \var buffer.
+     */
+    void setFrameHeader(uint8_t * buffer, uint16_t dataLength, bool calcCRC);
+    /*
+     * \brief Select getValue() resp. getValueAsString() by the type of the unused second parameter, see get<TAG>().
+     */
+    template <class cType>
+    cType getTyped(const SRscpValue* value, cType *) {
+    	return getValue<cType>(value);
+    }
+    std::string getTyped(const SRscpValue* value, std::string *) {
+    	return getValueAsString(value);
+    }
+
+    RscpArena * arena;
 };
 
 #endif /* RSCPPROTOCOL_H_ */
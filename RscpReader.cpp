@@ -13,13 +13,20 @@
 #include <errno.h>
 #include <unistd.h>
 #include <time.h>
+#include <math.h>
+#include <string.h>
 #include "RscpProtocol.h"
+#include "RscpFrameWriter.h"
+#include "RscpFrameParser.h"
 #include "RscpTags.h"
+#include "RscpTagSchema.h"
+#include "RscpContainer.h"
+#include "RscpHistory.h"
+#include "RscpSession.h"
+#include "RscpRetry.h"
+#include "RscpEventLoop.h"
+#include "RscpUringLoop.h"
 #include "SocketConnection.h"
-#include "AES.h"
-
-#define AES_KEY_SIZE        32
-#define AES_BLOCK_SIZE      32
 
 //
 // globals
@@ -27,6 +34,9 @@
 SRscpTimestamp start, interval, span;
 SRscpTag spanTag = TAG_DB_REQ_HISTORY_DATA_DAY;	// e.g. TAG_DB_REQ_HISTORY_DATA_MONTH
 
+// all reports of this run; they are requested over one connection per S10 and answered in the same order
+static std::vector<SRscpHistoryRequest> requests;
+
 //#define SERVER_IP
 const char * ip_addr;
 //#define SERVER_PORT         5033
@@ -39,12 +49,20 @@ const char * e3dc_password;
 //#define AES_PASSWORD        ""
 const char * aes_password;
 
-static int iSocket = -1;
-static int iAuthenticated = 0;
-static AES aesEncrypter;
-static AES aesDecrypter;
-static uint8_t ucEncryptionIV[AES_BLOCK_SIZE];
-static uint8_t ucDecryptionIV[AES_BLOCK_SIZE];
+// one S10 of a fleet file
+struct device_t {
+	std::string ip;
+	int port;
+	std::string user;
+	std::string password;
+	std::string aes;
+};
+// the S10s read at the same time; empty if only the one given on the command line is read
+static std::vector<device_t> fleet;
+// io_uring instead of epoll for the connections
+static bool use_uring = false;
+// reconnects of a S10 that failed, only the reports not answered yet are requested again
+static SRscpRetryPolicy retry_policy = RSCP_RETRY_DEFAULT;
 
 bool brief = false;	// brief report; sum only
 
@@ -64,118 +82,118 @@ const char * db_value_prefix() {
 	}
 }
 
-int graph_index = 0;
-int db_value_container(RscpProtocol *protocol, std::vector<SRscpValue> *dbVal) {
-	// does not make sense for year, because months have not the same length but only one interval is possible
-	if (spanTag == TAG_DB_REQ_HISTORY_DATA_YEAR || brief) {
+// name of a tag for the log, from the generated schema
+const char * tag_name(SRscpTag tag) {
+	const char * name = RscpTagSchema::name(tag);
+	return (name != NULL) ? name : "unknown";
+}
+
+// how a history value is printed behind its label
+enum db_format_t {
+	DB_FORMAT_POWER,	// with the unit W resp. Wh
+	DB_FORMAT_PERCENT,
+	DB_FORMAT_PLAIN,	// one decimal
+	DB_FORMAT_FLOAT		// all decimals
+};
+
+struct db_field_t {
+	SRscpTag tag;
+	const char * label;
+	db_format_t format;
+};
+
+// all tags of a TAG_DB_SUM_CONTAINER resp. TAG_DB_VALUE_CONTAINER, in the order of the RscpHistory columns
+constexpr db_field_t db_fields[] = {
+	{ TAG_DB_GRAPH_INDEX, "graph index", DB_FORMAT_PLAIN },
+	{ TAG_DB_BAT_POWER_IN, "battery in", DB_FORMAT_POWER },
+	{ TAG_DB_BAT_POWER_OUT, "battery out", DB_FORMAT_POWER },
+	{ TAG_DB_DC_POWER, "production", DB_FORMAT_POWER },
+	{ TAG_DB_GRID_POWER_IN, "grid in", DB_FORMAT_POWER },
+	{ TAG_DB_GRID_POWER_OUT, "grid out", DB_FORMAT_POWER },
+	{ TAG_DB_CONSUMPTION, "consumption", DB_FORMAT_POWER },
+	{ TAG_DB_PM_0_POWER, "pm 0 power", DB_FORMAT_POWER },
+	{ TAG_DB_PM_1_POWER, "pm 1 power", DB_FORMAT_POWER },
+	{ TAG_DB_BAT_CHARGE_LEVEL, "bat charge level", DB_FORMAT_PERCENT },
+	{ TAG_DB_BAT_CYCLE_COUNT, "bat cycle count", DB_FORMAT_FLOAT },
+	{ TAG_DB_CONSUMED_PRODUCTION, "consumed production", DB_FORMAT_PLAIN },
+	{ TAG_DB_AUTARKY, "autarky", DB_FORMAT_FLOAT },
+};
+constexpr size_t db_field_count = sizeof(db_fields) / sizeof(db_fields[0]);
+
+// all history values are float columns, db_fields[i] is the label of column i
+constexpr bool db_fields_columns(size_t i = 0) {
+	return (i == db_field_count) || ((RscpTagSchema::dataType(db_fields[i].tag) == RSCP::eTypeFloat32) && (db_fields[i].tag == rscpHistoryTags[i]) && db_fields_columns(i + 1));
+}
+static_assert(db_field_count == eHistoryColumnCount, "db_fields needs a label for every RscpHistory column");
+static_assert(db_fields_columns(), "db_fields must be of type RSCP::eTypeFloat32 and in the order of the RscpHistory columns");
+
+void db_print_field(const db_field_t *field, float value, const char *unit) {
+	switch (field->format) {
+	case DB_FORMAT_POWER:
+		printf("%s: %0.1f %s\n", field->label, value, unit);
+		break;
+	case DB_FORMAT_PERCENT:
+		printf("%s: %0.1f %%\n", field->label, value);
+		break;
+	case DB_FORMAT_PLAIN:
+		printf("%s: %0.1f \n", field->label, value);
+		break;
+	case DB_FORMAT_FLOAT:
+		printf("%s: %f \n", field->label, value);
+		break;
+	}
+}
+
+// make \var request the current report for printing
+void history_select(const SRscpHistoryRequest &request) {
+	spanTag = request.spanTag;
+	start = request.start;
+	interval = request.interval;
+	span = request.span;
+}
+
+// response tag of the history request \var tag
+SRscpTag history_response_tag(SRscpTag tag) {
+	switch (tag) {
+	case TAG_DB_REQ_HISTORY_DATA_DAY:
+		return TAG_DB_HISTORY_DATA_DAY;
+	case TAG_DB_REQ_HISTORY_DATA_MONTH:
+		return TAG_DB_HISTORY_DATA_MONTH;
+	case TAG_DB_REQ_HISTORY_DATA_YEAR:
+		return TAG_DB_HISTORY_DATA_YEAR;
+	default:
 		return 0;
 	}
-	const char * value_prefix = db_value_prefix();
-	struct val_t {
-		float bat_in, bat_out;
-		float production; 	// production
-		float grid_in, grid_out;
-		float consumption;
-		float bat_charge_level, bat_cycle_count;
-		float consumed_prod, autarky;
-	} val;
-	// Day show Watts all others energy (Watt Hours)
-	const char * W;
-	W = "Wh";
+}
+
+int graph_index = 0;
+// Day show Watts all others energy (Watt Hours)
+const char * db_value_unit() {
 	if (spanTag == TAG_DB_REQ_HISTORY_DATA_DAY) {
-		W = "W";
+		return "W";
 	}
-	graph_index++;
-	time_t d = start.seconds + ((graph_index - 1) * interval.seconds);
-	printf("[%d]-%s Date: %d - %s", graph_index, value_prefix, (int) d, ctime(&d));
+	return "Wh";
+}
 
-	for (size_t i = 0; i < dbVal->size(); ++i) {
-		switch ((*dbVal)[i].tag) {
-		case TAG_DB_GRAPH_INDEX: {
-			float fgraph_index = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s graph index: %0.1f \n", graph_index, value_prefix, fgraph_index);
-			break;
-		}
-		case TAG_DB_BAT_POWER_IN: {
-			float bat_power_in = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s battery in: %0.1f %s\n", graph_index, value_prefix, bat_power_in, W);
-			val.bat_in = bat_power_in;
-			break;
-		}
-		case TAG_DB_BAT_POWER_OUT: {
-			float bat_power_out = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s battery out: %0.1f %s\n", graph_index, value_prefix, bat_power_out, W);
-			val.bat_out = bat_power_out;
-			break;
-		}
-		case TAG_DB_DC_POWER: {
-			float dc_power = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s production: %0.1f %s\n", graph_index, value_prefix, dc_power, W);
-			val.production = dc_power;
-			break;
-		}
-		case TAG_DB_GRID_POWER_IN: {
-			float grid_power_in = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s grid in: %0.1f %s\n", graph_index, value_prefix, grid_power_in, W);
-			val.grid_in = grid_power_in;
-			break;
-		}
-		case TAG_DB_GRID_POWER_OUT: {
-			float grid_power_out = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s grid out: %0.1f %s\n", graph_index, value_prefix, grid_power_out, W);
-			val.grid_out = grid_power_out;
-			break;
-		}
-		case TAG_DB_CONSUMPTION: {
-			float db_consumption = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s consumption: %0.1f %s\n", graph_index, value_prefix, db_consumption, W);
-			val.consumption = db_consumption;
-			break;
-		}
-		case TAG_DB_PM_0_POWER: {
-			float pm0_power = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s pm 0 power: %0.1f %s\n", graph_index, value_prefix, pm0_power, W);
-			break;
-		}
-		case TAG_DB_PM_1_POWER: {
-			float pm1_power = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s pm 1 power: %0.1f %s\n", graph_index, value_prefix, pm1_power, W);
-			break;
-		}
-		case TAG_DB_BAT_CHARGE_LEVEL: {
-			float bat_level = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s bat charge level: %0.1f %%\n", graph_index, value_prefix, bat_level);
-			val.bat_charge_level = bat_level;
-			break;
-		}
-		case TAG_DB_BAT_CYCLE_COUNT: {
-			float cycle = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s bat cycle count: %f \n", graph_index, value_prefix, cycle);
-			val.bat_cycle_count = cycle;
-			break;
-		}
-		case TAG_DB_CONSUMED_PRODUCTION: {
-			float prod = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s consumed production: %0.1f \n", graph_index, value_prefix, prod);
-			val.consumed_prod = prod;
-			break;
-		}
-		case TAG_DB_AUTARKY: {
-			float aut = protocol->getValueAsFloat32(&((*dbVal)[i]));
-			printf("[%d]-%s autarky: %f \n", graph_index, value_prefix, aut);
-			val.autarky = aut;
-			break;
-		}
-		default:
-			rWarning("Unknown dbVal tag %08X\n", (*dbVal)[i].tag);
+// one interval; the values it did not have are NaN and not printed, the CSV shows them as nan
+void db_value(const RscpHistory &history, size_t i) {
+	const char * value_prefix = db_value_prefix();
+	graph_index = i + 1;
+	time_t d = history.getTimestamps()[i];
+	printf("[%d]-%s Date: %d - %s", graph_index, value_prefix, (int) d, ctime(&d));
+	for (size_t c = 0; c < db_field_count; c++) {
+		float value = history.getValue((eRscpHistoryColumn) c, i);
+		if (!isnan(value)) {
+			printf("[%d]-%s ", graph_index, value_prefix);
+			db_print_field(&db_fields[c], value, db_value_unit());
 		}
 	}
 	if (graph_index == 1) {
 		printf("[%d]-%s-CSV-head: date;batin;batout;batsoc;pro;netin;netout;con\n", graph_index, value_prefix);
 	}
-	printf("[%d]-%s-CSV: %d;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f\n", graph_index, value_prefix, (int) d, val.bat_in, val.bat_out, val.bat_charge_level, val.production, val.grid_in,
-			val.grid_out, val.consumption);
-	return 0;
+	printf("[%d]-%s-CSV: %d;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f\n", graph_index, value_prefix, (int) d, history.getValue(eHistoryBatPowerIn, i),
+			history.getValue(eHistoryBatPowerOut, i), history.getValue(eHistoryBatChargeLevel, i), history.getValue(eHistoryDCPower, i),
+			history.getValue(eHistoryGridPowerIn, i), history.getValue(eHistoryGridPowerOut, i), history.getValue(eHistoryConsumption, i));
 }
 
 const char * db_sum_prefix() {
@@ -191,137 +209,50 @@ const char * db_sum_prefix() {
 	}
 }
 
-int db_sum_container(RscpProtocol *protocol, std::vector<SRscpValue> *dbSum) {
+void db_sum(const RscpHistory &history) {
 	graph_index = 0;
 	time_t d = start.seconds;
 	const char * sum_prefix = db_sum_prefix();
 	printf("%s start: %d - %s", sum_prefix, (int) d, ctime(&d));
 	d = start.seconds + span.seconds;
 	printf("%s end: %d - %s", sum_prefix, (int) d, ctime(&d));
-	struct sum_t {
-		float bat_in, bat_out;
-		float production; 	// production
-		float grid_in, grid_out;
-		float consumption;
-		float bat_charge_level, bat_cycle_count;
-		float consumed_prod, autarky;
-	} sum;
-	for (size_t i = 0; i < dbSum->size(); ++i) {
-		switch ((*dbSum)[i].tag) {
-		case TAG_DB_GRAPH_INDEX: {
-			float graph_index = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s graph index: %0.1f \n", sum_prefix, graph_index);
-			break;
-		}
-		case TAG_DB_BAT_POWER_IN: {
-			float bat_power_in = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s battery in: %0.1f Wh\n", sum_prefix, bat_power_in);
-			sum.bat_in = bat_power_in;
-			break;
-		}
-		case TAG_DB_BAT_POWER_OUT: {
-			float bat_power_out = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s battery out: %0.1f Wh\n", sum_prefix, bat_power_out);
-			sum.bat_out = bat_power_out;
-			break;
-		}
-		case TAG_DB_DC_POWER: {
-			float dc_power = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s production: %0.1f Wh\n", sum_prefix, dc_power);
-			sum.production = dc_power;
-			break;
-		}
-		case TAG_DB_GRID_POWER_IN: {
-			float grid_power_in = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s grid in: %0.1f Wh\n", sum_prefix, grid_power_in);
-			sum.grid_in = grid_power_in;
-			break;
-		}
-		case TAG_DB_GRID_POWER_OUT: {
-			float grid_power_out = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s grid out: %0.1f Wh\n", sum_prefix, grid_power_out);
-			sum.grid_out = grid_power_out;
-			break;
-		}
-		case TAG_DB_CONSUMPTION: {
-			float db_consumption = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s consumption: %0.1f Wh\n", sum_prefix, db_consumption);
-			sum.consumption = db_consumption;
-			break;
-		}
-		case TAG_DB_PM_0_POWER: {
-			float pm0_power = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s pm 0 power: %0.1f Wh\n", sum_prefix, pm0_power);
-			break;
-		}
-		case TAG_DB_PM_1_POWER: {
-			float pm1_power = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s pm 1 power: %0.1f Wh\n", sum_prefix, pm1_power);
-			break;
-		}
-		case TAG_DB_BAT_CHARGE_LEVEL: {
-			float bat_level = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s bat charge level: %0.1f %%\n", sum_prefix, bat_level);
-			sum.bat_charge_level = bat_level;
-			break;
-		}
-		case TAG_DB_BAT_CYCLE_COUNT: {
-			float cycle = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s bat cycle count: %f \n", sum_prefix, cycle);
-			sum.bat_cycle_count = cycle;
-			break;
-		}
-		case TAG_DB_CONSUMED_PRODUCTION: {
-			float prod = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s consumed production: %0.1f \n", sum_prefix, prod);
-			sum.consumed_prod = prod;
-			break;
-		}
-		case TAG_DB_AUTARKY: {
-			float aut = protocol->getValueAsFloat32(&((*dbSum)[i]));
-			printf("%s autarky: %f \n", sum_prefix, aut);
-			sum.autarky = aut;
-			break;
-		}
-		default:
-			rWarning("Unknown dbSum tag %08X\n", (*dbSum)[i].tag);
+	for (size_t c = 0; c < db_field_count; c++) {
+		float value = history.getSum((eRscpHistoryColumn) c);
+		if (!isnan(value)) {
+			printf("%s ", sum_prefix);
+			db_print_field(&db_fields[c], value, "Wh");
 		}
 	}
 	printf("%s-CSV-head: date;batin;batout;batsoc;pro;netin;netout;con\n", sum_prefix);
-	printf("%s-CSV: %d;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f\n", sum_prefix, (int) start.seconds, sum.bat_in, sum.bat_out, sum.bat_charge_level, sum.production, sum.grid_in, sum.grid_out,
-			sum.consumption);
-	return 0;
+	printf("%s-CSV: %d;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f;%.2f\n", sum_prefix, (int) start.seconds, history.getSum(eHistoryBatPowerIn), history.getSum(eHistoryBatPowerOut),
+			history.getSum(eHistoryBatChargeLevel), history.getSum(eHistoryDCPower), history.getSum(eHistoryGridPowerIn), history.getSum(eHistoryGridPowerOut),
+			history.getSum(eHistoryConsumption));
 }
 
-int db_history_container(RscpProtocol *protocol, std::vector<SRscpValue> *c) {
-	for (size_t i = 0; i < c->size(); ++i) {
-		if ((*c)[i].dataType == RSCP::eTypeError) {
-			// handle error for example access denied errors
-			uint32_t uiErrorCode = protocol->getValueAsUInt32(&(*c)[i]);
-			rError("Tag 0x%08X received error code %u.\n", (*c)[i].tag, uiErrorCode);
-			return -1;
-		}
-		// db sub tags
-		switch ((*c)[i].tag) {
-		case TAG_DB_SUM_CONTAINER: {
-			std::vector<SRscpValue> dbSum = protocol->getValueAsContainer(&((*c)[i]));
-			db_sum_container(protocol, &dbSum);
-			break;
-		}
-		case TAG_DB_VALUE_CONTAINER: {
-			std::vector<SRscpValue> dbValue = protocol->getValueAsContainer(&((*c)[i]));
-			db_value_container(protocol, &dbValue);
-			break;
-		}
-		default:
-			rWarning("Unknown db tag %08X\n", (*c)[i].tag);
+//
+// print a TAG_DB_HISTORY_DATA_* response, decoded into columns
+void db_history(const RscpHistory &history) {
+	const std::vector<SRscpTag> & unknown = history.getUnknownTags();
+	for (size_t i = 0; i < unknown.size(); i++) {
+		rWarning("Unknown db tag %08X %s\n", unknown[i], tag_name(unknown[i]));
+	}
+	if (history.hasSum()) {
+		db_sum(history);
+	}
+	// does not make sense for year, because months have not the same length but only one interval is possible
+	if (spanTag != TAG_DB_REQ_HISTORY_DATA_YEAR && !brief) {
+		for (size_t i = 0; i < history.size(); i++) {
+			db_value(history, i);
 		}
 	}
-	return 0;
+	if (history.hasError()) {
+		// handle error for example access denied errors
+		rError("Tag 0x%08X received error code %u.\n", history.getErrorTag(), history.getError());
+	}
 }
 
-//
-int handleResponseValue(RscpProtocol *protocol, SRscpValue *response) {
+// history decodes the history responses, one decoder per reader instead of a static one
+int handleResponseValue(RscpProtocol *protocol, RscpHistory &history, const SRscpValue *response) {
 	// check if any of the response has the error flag set and react accordingly
 	if (response->dataType == RSCP::eTypeError) {
 		// handle error for example access denied errors
@@ -336,83 +267,84 @@ int handleResponseValue(RscpProtocol *protocol, SRscpValue *response) {
 		// It is possible to check the response->dataType value to detect correct data type
 		// and call the correct function. If data type is known,
 		// the correct function can be called directly like in this case.
-		uint8_t ucAccessLevel = protocol->getValueAsUChar8(response);
-		if (ucAccessLevel > 0) {
-			iAuthenticated = 1;
-		}
+		uint8_t ucAccessLevel = protocol->get<TAG_RSCP_AUTHENTICATION>(response);
 		rInfo("RSCP authentitication level %i\n", ucAccessLevel);
 		break;
 	}
 	case TAG_EMS_POWER_PV: {    // response for TAG_EMS_REQ_POWER_PV
-		int32_t iPower = protocol->getValueAsInt32(response);
+		int32_t iPower = protocol->get<TAG_EMS_POWER_PV>(response);
 		printf("EMS PV power is %i W\n", iPower);
 		break;
 	}
 	case TAG_EMS_POWER_BAT: {    // response for TAG_EMS_REQ_POWER_BAT
-		int32_t iPower = protocol->getValueAsInt32(response);
+		int32_t iPower = protocol->get<TAG_EMS_POWER_BAT>(response);
 		printf("EMS BAT power is %i W\n", iPower);
 		break;
 	}
 	case TAG_EMS_POWER_HOME: {    // response for TAG_EMS_REQ_POWER_HOME
-		int32_t iPower = protocol->getValueAsInt32(response);
+		int32_t iPower = protocol->get<TAG_EMS_POWER_HOME>(response);
 		printf("EMS house power is %i W\n", iPower);
 		break;
 	}
 	case TAG_EMS_POWER_GRID: {    // response for TAG_EMS_REQ_POWER_GRID
-		int32_t iPower = protocol->getValueAsInt32(response);
+		int32_t iPower = protocol->get<TAG_EMS_POWER_GRID>(response);
 		printf("EMS grid power is %i W\n", iPower);
 		break;
 	}
 	case TAG_EMS_POWER_ADD: {    // response for TAG_EMS_REQ_POWER_ADD
-		int32_t iPower = protocol->getValueAsInt32(response);
+		int32_t iPower = protocol->get<TAG_EMS_POWER_ADD>(response);
 		printf("EMS add power meter power is %i W\n", iPower);
 		break;
 	}
 	case TAG_DB_HISTORY_DATA_DAY:
 	case TAG_DB_HISTORY_DATA_MONTH:
 	case TAG_DB_HISTORY_DATA_YEAR: {
-		std::vector<SRscpValue> dbData = protocol->getValueAsContainer(response);
-		db_history_container(protocol, &dbData);
+		if (response->tag != history_response_tag(spanTag)) {
+			rWarning("History response %08X does not match the request %08X\n", response->tag, spanTag);
+		}
+		// all intervals at once into columns, read straight from the received data
+		history.decode(response, start.seconds, interval.seconds);
+		db_history(history);
 		break;
 	}
 	case TAG_BAT_DATA: {        // response for TAG_BAT_REQ_DATA
 		uint8_t ucBatteryIndex = 0;
-		std::vector<SRscpValue> batteryData = protocol->getValueAsContainer(response);
-		for (size_t i = 0; i < batteryData.size(); ++i) {
-			if (batteryData[i].dataType == RSCP::eTypeError) {
+		// the values are read in place, nothing is allocated
+		for (const SRscpValue & batteryData : RscpContainerRange(response)) {
+			if (batteryData.dataType == RSCP::eTypeError) {
 				// handle error for example access denied errors
-				uint32_t uiErrorCode = protocol->getValueAsUInt32(&batteryData[i]);
-				rError("Tag 0x%08X received error code %u.\n", batteryData[i].tag, uiErrorCode);
+				uint32_t uiErrorCode = protocol->getValueAsUInt32(&batteryData);
+				rError("Tag 0x%08X received error code %u.\n", batteryData.tag, uiErrorCode);
 				return -1;
 			}
 			// check each battery sub tag
-			switch (batteryData[i].tag) {
+			switch (batteryData.tag) {
 			case TAG_BAT_INDEX: {
-				ucBatteryIndex = protocol->getValueAsUChar8(&batteryData[i]);
+				ucBatteryIndex = protocol->get<TAG_BAT_INDEX>(&batteryData);
 				break;
 			}
 			case TAG_BAT_RSOC: {              // response for TAG_BAT_REQ_RSOC
-				float fSOC = protocol->getValueAsFloat32(&batteryData[i]);
+				float fSOC = protocol->get<TAG_BAT_RSOC>(&batteryData);
 				printf("Battery SOC is %0.1f %%\n", fSOC);
 				break;
 			}
 			case TAG_BAT_MODULE_VOLTAGE: { // response for TAG_BAT_REQ_MODULE_VOLTAGE
-				float fVoltage = protocol->getValueAsFloat32(&batteryData[i]);
+				float fVoltage = protocol->get<TAG_BAT_MODULE_VOLTAGE>(&batteryData);
 				printf("Battery total voltage is %0.1f V\n", fVoltage);
 				break;
 			}
 			case TAG_BAT_CURRENT: {    // response for TAG_BAT_REQ_CURRENT
-				float fVoltage = protocol->getValueAsFloat32(&batteryData[i]);
+				float fVoltage = protocol->get<TAG_BAT_CURRENT>(&batteryData);
 				printf("Battery current is %0.1f A\n", fVoltage);
 				break;
 			}
 			case TAG_BAT_STATUS_CODE: {  // response for TAG_BAT_REQ_STATUS_CODE
-				uint32_t uiErrorCode = protocol->getValueAsUInt32(&batteryData[i]);
+				uint32_t uiErrorCode = protocol->get<TAG_BAT_STATUS_CODE>(&batteryData);
 				printf("Battery status code is 0x%08X\n", uiErrorCode);
 				break;
 			}
 			case TAG_BAT_ERROR_CODE: {    // response for TAG_BAT_REQ_ERROR_CODE
-				uint32_t uiErrorCode = protocol->getValueAsUInt32(&batteryData[i]);
+				uint32_t uiErrorCode = protocol->get<TAG_BAT_ERROR_CODE>(&batteryData);
 				printf("Battery error code is 0x%08X\n", uiErrorCode);
 				break;
 			}
@@ -423,336 +355,319 @@ int handleResponseValue(RscpProtocol *protocol, SRscpValue *response) {
 				break;
 			}
 		}
-		protocol->destroyValueData(batteryData);
 		break;
 	}
 		// ...
 	default:
 		// default behavior
-		rWarning("Unknown tag %08X\n", response->tag);
+		rWarning("Unknown tag %08X %s\n", response->tag, tag_name(response->tag));
 		break;
 	}
 	return 0;
 }
 
-static int processReceiveBuffer(const unsigned char * ucBuffer, int iLength) {
-	RscpProtocol protocol;
-	SRscpFrame frame;
-
-	int iResult = protocol.parseFrame(ucBuffer, iLength, &frame);
-	rDebug("processReceiveBuffer result for parseFrame: %d", iResult);
-	if (iResult < 0) {
-		// check if frame length error occured
-		// in that case the full frame length was not received yet
-		// and the receive function must get more data
-		if (iResult == RSCP::ERR_INVALID_FRAME_LENGTH) {
-			return 0;
-		}
-		// otherwise a not recoverable error occured and the connection can be closed
-		else {
-			return iResult;
-		}
+//
+// prints the responses of all S10s, they are handled one after the other in the thread of the event loop
+//
+class ReaderHandler: public RscpSessionHandler {
+public:
+	ReaderHandler() :
+			lastSession(NULL) {
 	}
 
-	int iProcessedBytes = iResult;
+	//
+	// the data request of report index, the values are written straight into the frame
+	//
+	void request(RscpSession & session, const SRscpHistoryRequest & request, size_t index, RscpFrameWriter & writer) {
+		rInfo("Generating request for historical data\n");
+		// request power data information, the current values are needed only once
+		if (index == 0) {
+			writer.appendValue(TAG_EMS_REQ_POWER_PV);
+			writer.appendValue(TAG_EMS_REQ_POWER_BAT);
+			writer.appendValue(TAG_EMS_REQ_POWER_HOME);
+			writer.appendValue(TAG_EMS_REQ_POWER_GRID);
+			writer.appendValue(TAG_EMS_REQ_POWER_ADD);
+		}
 
-	// process each SRscpValue struct seperately
-	for (unsigned int i = 0; i < frame.data.size(); i++) {
-		handleResponseValue(&protocol, &frame.data[i]);
-	}
+		// request battery information
+//        writer.openContainer(TAG_BAT_REQ_DATA);
+//        writer.appendValue(TAG_BAT_INDEX, (uint8_t)0);
+//        writer.appendValue(TAG_BAT_REQ_RSOC);
+//        writer.appendValue(TAG_BAT_REQ_MODULE_VOLTAGE);
+//        writer.appendValue(TAG_BAT_REQ_CURRENT);
+//        writer.appendValue(TAG_BAT_REQ_STATUS_CODE);
+//        writer.appendValue(TAG_BAT_REQ_ERROR_CODE);
+//        writer.closeContainer();
 
-	// destroy frame data and free memory
-	protocol.destroyFrameData(frame);
+		// request db information
+		time_t end = request.start.seconds + request.span.seconds;
+		time_t s = request.start.seconds;
+		rDebug("Start time: %s", ctime(&s));
+		rDebug("interval: %d, Span seconds: %d", (int )request.interval.seconds, (int ) request.span.seconds);
+		rDebug("End time: %s", ctime(&end));
+		RscpSessionHandler::request(session, request, index, writer);
+	}
 
-	// returned processed amount of bytes
-	return iProcessedBytes;
-}
+	// each value as soon as it is complete, zero copy from the receive buffer
+	void value(RscpSession & session, const SRscpHistoryRequest * request, const SRscpValue & value) {
+		// with a fleet the output of each S10 starts with its address
+		if (!fleet.empty() && (&session != lastSession)) {
+			printf("S10: %s\n", session.getName());
+			lastSession = &session;
+		}
+		if (request != NULL) {
+			history_select(*request);
+		}
+		handleResponseValue(&protocol, history, &value);
+	}
 
-//
-// receiving packages
-//
-static void receiveLoop(bool & bStopExecution) {
-	//--------------------------------------------------------------------------------------------------------------
-	// RSCP Receive Frame Block Data
-	//--------------------------------------------------------------------------------------------------------------
-	// setup a static dynamic buffer which is dynamically expanded (re-allocated) on demand
-	// the data inside this buffer is not released when this function is left
-	static int iReceivedBytes = 0;
-	static std::vector<uint8_t> vecDynamicBuffer;
-
-	// check how many RSCP frames are received, must be at least 1
-	// multiple frames can only occur in this example if one or more frames are received with a big time delay
-	// this should usually not occur but handling this is shown in this example
-	int iReceivedRscpFrames = 0;
-	while (!bStopExecution && ((iReceivedBytes > 0) || iReceivedRscpFrames == 0)) {
-		// check and expand buffer
-		if ((vecDynamicBuffer.size() - iReceivedBytes) < 4096) {
-			// check maximum size
-			if (vecDynamicBuffer.size() > RSCP_MAX_FRAME_LENGTH) {
-				// something went wrong and the size is more than possible by the RSCP protocol
-				rError("Maximum buffer size exceeded %i\n", (int ) vecDynamicBuffer.size());
-				bStopExecution = true;
-				break;
-			}
-			// increase buffer size by 4096 bytes each time the remaining size is smaller than 4096
-			vecDynamicBuffer.resize(vecDynamicBuffer.size() + 4096);
+	void retrying(RscpSession & session, int error, uint32_t delayMs) {
+		if (session.getBreakerState() == RscpCircuitBreaker::eStateOpen) {
+			rWarning("%s: %s, failing too often, paused for %u ms\n", session.getName(), strerror(error), delayMs);
+		} else {
+			rWarning("%s: %s, retry in %u ms\n", session.getName(), strerror(error), delayMs);
 		}
-		// receive data
-		int iResult = SocketRecvData(iSocket, &vecDynamicBuffer[0] + iReceivedBytes, vecDynamicBuffer.size() - iReceivedBytes);
-		if (iResult < 0) {
-			// check errno for the error code to detect if this is a timeout or a socket error
-			if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
-				// receive timed out -> continue with re-sending the initial block
-				rError("Response receive timeout (retry)\n");
+	}
 
-			}
-			// socket error -> check errno for failure code if needed
-			rError("Socket receive error. errno %i\n", errno);
-			bStopExecution = true;
+	void finished(RscpSession & session, int error) {
+		switch (error) {
+		case 0:
+			rDebug("%s: all reports received", session.getName());
 			break;
-		} else if (iResult == 0) {
-			// connection was closed regularly by peer
+		case EACCES:
+			rError("%s: Authentication failed\n", session.getName());
+			break;
+		case ECONNRESET:
 			// if this happens on startup each time the possible reason is
 			// wrong AES password or wrong network subnet (adapt hosts.allow file required)
-			rError("Connection closed by peer\n");
-			bStopExecution = true;
+			rError("%s: Connection closed by peer\n", session.getName());
 			break;
-		}
-		rDebug("Received %d bytes", iResult);
-		// increment amount of received bytes
-		iReceivedBytes += iResult;
-
-		// process all received frames
-		while (!bStopExecution) {
-			// round down to a multiple of AES_BLOCK_SIZE
-			int iLength = ROUNDDOWN(iReceivedBytes, AES_BLOCK_SIZE);
-			// if not even 32 bytes were received then the frame is still incomplete
-			if (iLength == 0) {
-				break;
-			}
-			// resize temporary decryption buffer
-			std::vector<uint8_t> decryptionBuffer;
-			decryptionBuffer.resize(iLength);
-			// initialize encryption sequence IV value with value of previous block
-			aesDecrypter.SetIV(ucDecryptionIV, AES_BLOCK_SIZE);
-			// decrypt data from vecDynamicBuffer to temporary decryptionBuffer
-			aesDecrypter.Decrypt(&vecDynamicBuffer[0], &decryptionBuffer[0], iLength / AES_BLOCK_SIZE);
-
-			// data was received, check if we received all data
-			int iProcessedBytes = processReceiveBuffer(&decryptionBuffer[0], iLength);
-			if (iProcessedBytes < 0) {
-				// an error occured;
-				rError("Error parsing RSCP frame: %i\n", iProcessedBytes);
-				// stop execution as the data received is not RSCP data
-				bStopExecution = true;
-				break;
-
-			} else if (iProcessedBytes > 0) {
-				// round up the processed bytes as iProcessedBytes does not include the zero padding bytes
-				iProcessedBytes = ROUNDUP(iProcessedBytes, AES_BLOCK_SIZE);
-				// store the IV value from encrypted buffer for next block decryption
-				memcpy(ucDecryptionIV, &vecDynamicBuffer[0] + iProcessedBytes - AES_BLOCK_SIZE,
-				AES_BLOCK_SIZE);
-				// move the encrypted data behind the current frame data (if any received) to the front
-				memcpy(&vecDynamicBuffer[0], &vecDynamicBuffer[0] + iProcessedBytes, vecDynamicBuffer.size() - iProcessedBytes);
-				// decrement the total received bytes by the amount of processed bytes
-				iReceivedBytes -= iProcessedBytes;
-				// increment a counter that a valid frame was received and
-				// continue parsing process in case a 2nd valid frame is in the buffer as well
-				iReceivedRscpFrames++;
+		case ETIMEDOUT:
+			rError("%s: Response receive timeout\n", session.getName());
+			break;
+		case EBADMSG:
+			rError("%s: Error parsing RSCP frame\n", session.getName());
+			break;
+		case EPROTO:
+			// the first frame could not be decrypted
+			rError("%s: No RSCP response, wrong AES password?\n", session.getName());
+			break;
+		case EINVAL: {
+			// an address that can not be converted ends the connect with EINVAL, like a request that can not be built
+			struct sockaddr_in address;
+			if (!SocketAddress(session.getIp(), session.getPort(), &address)) {
+				rError("%s: IP address %s cannot be converted.\n", session.getName(), session.getIp());
 			} else {
-				// iProcessedBytes is 0
-				// not enough data of the next frame received, go back to receive mode if iReceivedRscpFrames == 0
-				// or transmit mode if iReceivedRscpFrames > 0
-				break;
+				rError("%s: Connection failed: %s\n", session.getName(), strerror(error));
 			}
+			break;
+		}
+		default:
+			rError("%s: Connection failed: %s\n", session.getName(), strerror(error));
+			break;
 		}
 	}
+
+private:
+	RscpProtocol protocol;
+	RscpHistory history;	// decodes one history response at a time, for all S10s
+	const RscpSession * lastSession;	// S10 of the last printed value
+};
+
+// connect all sessions and run them until the last one is finished; Loop is RscpEventLoop or RscpUringLoop
+template<class Loop> static int run_sessions(Loop &loop, std::vector<RscpSession *> &sessions) {
+	for (size_t i = 0; i < sessions.size(); i++) {
+		// all S10s get the same reports
+		sessions[i]->setRequests(requests);
+		sessions[i]->setRetryPolicy(retry_policy);
+		rInfo("Connecting to server %s\n", sessions[i]->getName());
+		loop.add(sessions[i]);
+	}
+	return loop.run();
 }
 
 //
-// create an Rscp request
-// either an authentication request
-// or a data request
+// real RSCP reader
+// authenticate once per S10, then keep up to RSCP_PIPELINE_DEPTH history requests on the way
+// until all reports are received; all S10s of a fleet are read at the same time in one thread
 //
-int createRequest(SRscpFrameBuffer * frameBuffer) {
-	RscpProtocol protocol;
-	SRscpValue rootValue;
-	// The root container is create with the TAG ID 0 which is not used by any device.
-	protocol.createContainerValue(&rootValue, 0);
-
-	//---------------------------------------------------------------------------------------------------------
-	// Create a request frame
-	//---------------------------------------------------------------------------------------------------------
-	if (iAuthenticated == 0) {
-		rInfo("Generating request authentication\n");
-		// authentication request
-		SRscpValue authenContainer;
-		protocol.createContainerValue(&authenContainer,
-		TAG_RSCP_REQ_AUTHENTICATION);
-		protocol.appendValue(&authenContainer, TAG_RSCP_AUTHENTICATION_USER, e3dc_user);
-		protocol.appendValue(&authenContainer, TAG_RSCP_AUTHENTICATION_PASSWORD, e3dc_password);
-		// append sub-container to root container
-		protocol.appendValue(&rootValue, authenContainer);
-		// free memory of sub-container as it is now copied to rootValue
-		protocol.destroyValueData(authenContainer);
-	} else {
-		rInfo("Generating request for historical data\n");
-		// request power data information
-		protocol.appendValue(&rootValue, TAG_EMS_REQ_POWER_PV);
-		protocol.appendValue(&rootValue, TAG_EMS_REQ_POWER_BAT);
-		protocol.appendValue(&rootValue, TAG_EMS_REQ_POWER_HOME);
-		protocol.appendValue(&rootValue, TAG_EMS_REQ_POWER_GRID);
-		protocol.appendValue(&rootValue, TAG_EMS_REQ_POWER_ADD);
+int RscpReader() {
+	ReaderHandler handler;
+	std::vector<RscpSession *> sessions;
 
-		// request battery information
-//        SRscpValue batteryContainer;
-//        protocol.createContainerValue(&batteryContainer, TAG_BAT_REQ_DATA);
-//        protocol.appendValue(&batteryContainer, TAG_BAT_INDEX, (uint8_t)0);
-//        protocol.appendValue(&batteryContainer, TAG_BAT_REQ_RSOC);
-//        protocol.appendValue(&batteryContainer, TAG_BAT_REQ_MODULE_VOLTAGE);
-//        protocol.appendValue(&batteryContainer, TAG_BAT_REQ_CURRENT);
-//        protocol.appendValue(&batteryContainer, TAG_BAT_REQ_STATUS_CODE);
-//        protocol.appendValue(&batteryContainer, TAG_BAT_REQ_ERROR_CODE);
-//        // append sub-container to root container
-//        protocol.appendValue(&rootValue, batteryContainer);
-//        // free memory of sub-container as it is now copied to rootValue
-//        protocol.destroyValueData(batteryContainer);
-		// request db information
-		SRscpValue dbContainer;
-		protocol.createContainerValue(&dbContainer, spanTag);
+	if (fleet.empty()) {
+		RscpSession * session = new RscpSession(handler);
+		session->setDevice(ip_addr, port_number, e3dc_user, e3dc_password, aes_password);
+		sessions.push_back(session);
+	}
+	for (size_t i = 0; i < fleet.size(); i++) {
+		RscpSession * session = new RscpSession(handler);
+		session->setDevice(fleet[i].ip.c_str(), fleet[i].port, fleet[i].user.c_str(), fleet[i].password.c_str(), fleet[i].aes.c_str());
+		sessions.push_back(session);
+	}
 
-		time_t end = start.seconds + span.seconds;
-		time_t s = start.seconds;
-		rDebug("Start time: %s", ctime(&s));
-		rDebug("interval: %d, Span seconds: %d", (int )interval.seconds, (int ) span.seconds);
-		rDebug("End time: %s", ctime(&end));
-		protocol.appendValue(&dbContainer, TAG_DB_REQ_HISTORY_TIME_START, start);
-		protocol.appendValue(&dbContainer, TAG_DB_REQ_HISTORY_TIME_INTERVAL, interval);
-		protocol.appendValue(&dbContainer, TAG_DB_REQ_HISTORY_TIME_SPAN, span);
-		protocol.appendValue(&rootValue, dbContainer);
-		protocol.destroyValueData(&dbContainer);
+	int failed = -1;
+	if (use_uring) {
+		RscpUringLoop uring;
+		if (uring.isAvailable()) {
+			failed = run_sessions(uring, sessions);
+		} else {
+			rWarning("io_uring is not available, using epoll\n");
+		}
+	}
+	if (failed < 0) {
+		RscpEventLoop loop;
+		failed = run_sessions(loop, sessions);
+	}
+	rDebug("readerLoop ended, %d of %d failed", failed, (int) sessions.size());
 
+	for (size_t i = 0; i < sessions.size(); i++) {
+		delete sessions[i];
 	}
+	return (failed != 0) ? 1 : 0;
+}
 
-	// create buffer frame to send data to the S10
-	protocol.createFrameAsBuffer(frameBuffer, rootValue.data, rootValue.length, true); // true to calculate CRC on for transfer
-	// the root value object should be destroyed after the data is copied into the frameBuffer and is not needed anymore
-	protocol.destroyValueData(rootValue);
+//
+// use io_uring for the connections, falls back to epoll if the kernel does not support it
+//
+void RscpReader_Uring(bool on) {
+	use_uring = on;
+}
 
-	return 0;
+//
+// reconnect up to retries times after a failed connection (0 = no retry); the delays start at
+// baseMs and double up to maxMs, each randomly 25% shorter or longer
+//
+void RscpReader_Retry(int retries, int baseMs, int maxMs) {
+	retry_policy.maxRetries = retries;
+	retry_policy.baseDelayMs = baseMs;
+	retry_policy.maxDelayMs = (maxMs > baseMs) ? maxMs : baseMs;
 }
 
 //
-// loop through authentication and request data
+// a S10 with failures failed connections within seconds is paused for seconds (failures 0 = never)
 //
-static void readerLoop(void) {
-	RscpProtocol protocol;
-	bool bStopExecution = false;
-	int loop_count = 0;
-
-	while (!bStopExecution) {
-		//--------------------------------------------------------------------------------------------------------------
-		// RSCP Transmit Frame Block Data
-		//--------------------------------------------------------------------------------------------------------------
-		SRscpFrameBuffer frameBuffer;
-		memset(&frameBuffer, 0, sizeof(frameBuffer));
-
-		// create an RSCP frame with requests to some example data
-		createRequest(&frameBuffer);
-
-		// check that frame data was created
-		if (frameBuffer.dataLength > 0) {
-			// resize temporary encryption buffer to a multiple of AES_BLOCK_SIZE
-			std::vector<uint8_t> encryptionBuffer;
-			encryptionBuffer.resize(ROUNDUP(frameBuffer.dataLength, AES_BLOCK_SIZE));
-			// zero padding for data above the desired length
-			memset(&encryptionBuffer[0] + frameBuffer.dataLength, 0, encryptionBuffer.size() - frameBuffer.dataLength);
-			// copy desired data length
-			memcpy(&encryptionBuffer[0], frameBuffer.data, frameBuffer.dataLength);
-			// set continues encryption IV
-			aesEncrypter.SetIV(ucEncryptionIV, AES_BLOCK_SIZE);
-			// start encryption from encryptionBuffer to encryptionBuffer, blocks = encryptionBuffer.size() / AES_BLOCK_SIZE
-			aesEncrypter.Encrypt(&encryptionBuffer[0], &encryptionBuffer[0], encryptionBuffer.size() / AES_BLOCK_SIZE);
-			// save new IV for next encryption block
-			memcpy(ucEncryptionIV, &encryptionBuffer[0] + encryptionBuffer.size() - AES_BLOCK_SIZE,
-			AES_BLOCK_SIZE);
-
-			// send data on socket
-			int iResult = SocketSendData(iSocket, &encryptionBuffer[0], encryptionBuffer.size());
-			if (iResult < 0) {
-				rError("Socket send error %i. errno %i\n", iResult, errno);
-				bStopExecution = true;
-			} else {
-				// go into receive loop and wait for response
-				receiveLoop(bStopExecution);
-			}
-		}
-		// free frame buffer memory
-		protocol.destroyFrameData(&frameBuffer);
+void RscpReader_Breaker(int failures, int seconds) {
+	retry_policy.breakerFailures = failures;
+	retry_policy.breakerWindowMs = seconds * 1000;
+}
 
-		//bStopExecution = true;
-		loop_count++;
-		if (loop_count > 1) {
-			bStopExecution = true;
+//
+// read the S10s of a fleet file instead of the one on the command line
+// one line per S10: ip port user password aes-password; empty lines and lines starting with # are skipped
+// returns the number of S10s or -1 if the file cannot be read
+//
+int RscpReader_Fleet(const char * file) {
+	FILE * f = fopen(file, "r");
+	if (f == NULL) {
+		rError("Cannot open fleet file %s: %s\n", file, strerror(errno));
+		return -1;
+	}
+	fleet.clear();
+	char line[1024];
+	int lineNumber = 0;
+	while (fgets(line, sizeof(line), f) != NULL) {
+		lineNumber++;
+		char ip[256], user[256], password[256], aes[256];
+		int port;
+		char first[2];
+		if ((sscanf(line, " %1s", first) != 1) || (first[0] == '#')) {
+			continue;
+		}
+		if ((sscanf(line, "%255s %d %255s %255s %255s", ip, &port, user, password, aes) != 5) || (port <= 0) || (port > 65535)) {
+			rError("Fleet file %s line %d: expected ip port user password aes-password\n", file, lineNumber);
+			fclose(f);
+			return -1;
 		}
-
-		// main loop sleep / cycle time before next request
-		sleep(1);
+		device_t device;
+		device.ip = ip;
+		device.port = port;
+		device.user = user;
+		device.password = password;
+		device.aes = aes;
+		fleet.push_back(device);
 	}
+	fclose(f);
+	return fleet.size();
 }
 
 //
-// real RSCP reader
-//
-int RscpReader() {
-	// connect to server
-	rInfo("Connecting to server %s:%i\n", ip_addr, port_number);
-	iSocket = SocketConnect(ip_addr, port_number);
-	if (iSocket < 0) {
-		rError("Connection failed\n");
-		return (1);
-	}
-	rInfo("Connected successfully\n");
-
-	// reset authentication flag
-	iAuthenticated = 0;
-
-	// create AES key and set AES parameters
-	{
-		// initialize AES encryptor and decryptor IV
-		memset(ucDecryptionIV, 0xff, AES_BLOCK_SIZE);
-		memset(ucEncryptionIV, 0xff, AES_BLOCK_SIZE);
-
-		// limit password length to AES_KEY_SIZE
-		int iPasswordLength = strlen(aes_password);
-		if (iPasswordLength > AES_KEY_SIZE)
-			iPasswordLength = AES_KEY_SIZE;
-
-		// copy up to 32 bytes of AES key password
-		uint8_t ucAesKey[AES_KEY_SIZE];
-		memset(ucAesKey, 0xff, AES_KEY_SIZE);
-		memcpy(ucAesKey, aes_password, iPasswordLength);
-
-		// set encryptor and decryptor parameters
-		aesDecrypter.SetParameters(AES_KEY_SIZE * 8, AES_BLOCK_SIZE * 8);
-		aesEncrypter.SetParameters(AES_KEY_SIZE * 8, AES_BLOCK_SIZE * 8);
-		aesDecrypter.StartDecryption(ucAesKey);
-		aesEncrypter.StartEncryption(ucAesKey);
-	}
-
-	readerLoop();
-	rDebug("readerLoop ended");
-
-	// close socket connection
-	SocketClose(iSocket);
-	iSocket = -1;
-	return errno;
+// times of the history request of one day, month or year starting at l
+static SRscpHistoryRequest history_day(struct tm l) {
+	SRscpHistoryRequest request;
+	request.spanTag = TAG_DB_REQ_HISTORY_DATA_DAY;
+	request.start.seconds = mktime(&l);
+	request.start.nanoseconds = 0;
+	if (brief) {
+		request.interval.seconds = 24 * 3600;
+	} else {
+		request.interval.seconds = 15 * 60; // 15 minutes
+	}
+	request.interval.nanoseconds = 0;
+	request.span.seconds = 24 * 3600-1;
+	request.span.nanoseconds = 0;
+	return request;
+}
+
+static SRscpHistoryRequest history_month(struct tm l) {
+	SRscpHistoryRequest request;
+	request.spanTag = TAG_DB_REQ_HISTORY_DATA_MONTH;
+	request.start.seconds = mktime(&l);
+	request.start.nanoseconds = 0;
+
+	request.interval.nanoseconds = 0;
+	if (l.tm_mon == 11) {
+		l.tm_mon = 0;
+		l.tm_year++;
+		request.span.seconds = mktime(&l) - request.start.seconds - 1;
+	} else {
+		l.tm_mon++;
+		request.span.seconds = mktime(&l) - request.start.seconds - 1;
+	}
+	request.span.nanoseconds = 0;
+	if (brief) {
+		request.interval.seconds = request.start.seconds + request.span.seconds;
+	} else {
+		request.interval.seconds = 24 * 3600; // 1 day
+	}
+	return request;
+}
+
+static SRscpHistoryRequest history_year(struct tm l) {
+	SRscpHistoryRequest request;
+	request.spanTag = TAG_DB_REQ_HISTORY_DATA_YEAR;
+	// only the sum of the year makes sense, month do not have equal length
+	request.start.seconds = mktime(&l);
+	request.start.nanoseconds = 0;
+
+	request.interval.nanoseconds = 0;
+	l.tm_year++;
+	request.span.seconds = mktime(&l) - request.start.seconds - 1;
+	request.span.nanoseconds = 0;
+	request.interval.seconds = request.span.seconds; // does not matter, only sum is valid
+	return request;
+}
+
+// queue count reports of span starting at l, the next one starts one step (e.g. tm_mday) later;
+// reports that start in the future are left out
+static void history_queue(SRscpHistoryRequest (*span)(struct tm), int tm::*step, struct tm *l, int count) {
+	time_t now = time(NULL);
+	requests.clear();
+	for (int i = 0; i < count; i++) {
+		struct tm t = *l;
+		t.*step += i;
+		SRscpHistoryRequest request = span(t);
+		if ((i > 0) && ((time_t) request.start.seconds >= now)) {
+			break;
+		}
+		requests.push_back(request);
+	}
+	history_select(requests[0]);
 }
 
 //
-// wrapper, setting the time and interval
-int RscpReader_Day(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool b) {
+// wrapper, setting the time and interval of count consecutive days, months resp. years
+int RscpReader_Day(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool b, int count) {
 	rDebug("RscpReader_Day");
 	brief = b;
 	e3dc_user = user;
@@ -760,21 +675,11 @@ int RscpReader_Day(const char * user, const char *pw, const char *aes, const cha
 	aes_password = aes;
 	ip_addr = ip;
 	port_number = port;
-	spanTag = TAG_DB_REQ_HISTORY_DATA_DAY;
-	start.seconds = mktime(l);
-	start.nanoseconds = 0;
-	if (brief) {
-		interval.seconds = 24 * 3600;
-	} else {
-		interval.seconds = 15 * 60; // 15 minutes
-	}
-	interval.nanoseconds = 0;
-	span.seconds = 24 * 3600-1;
-	span.nanoseconds = 0;
+	history_queue(history_day, &tm::tm_mday, l, count);
 	return RscpReader();
 }
 
-int RscpReader_Month(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool b) {
+int RscpReader_Month(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool b, int count) {
 	rDebug("RscpReader_Month");
 	brief = b;
 	e3dc_user = user;
@@ -782,29 +687,11 @@ int RscpReader_Month(const char * user, const char *pw, const char *aes, const c
 	aes_password = aes;
 	ip_addr = ip;
 	port_number = port;
-	spanTag = TAG_DB_REQ_HISTORY_DATA_MONTH;
-	start.seconds = mktime(l);
-	start.nanoseconds = 0;
-
-	interval.nanoseconds = 0;
-	if (l->tm_mon == 11) {
-		l->tm_mon = 0;
-		l->tm_year++;
-		span.seconds = mktime(l) - start.seconds - 1;
-	} else {
-		l->tm_mon++;
-		span.seconds = mktime(l) - start.seconds - 1;
-	}
-	span.nanoseconds = 0;
-	if (brief) {
-		interval.seconds = start.seconds + span.seconds;
-	} else {
-		interval.seconds = 24 * 3600; // 1 day
-	}
+	history_queue(history_month, &tm::tm_mon, l, count);
 	return RscpReader();
 }
 
-int RscpReader_Year(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool b) {
+int RscpReader_Year(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool b, int count) {
 	rDebug("RscpReader_Year");
 	brief = b;
 	e3dc_user = user;
@@ -812,15 +699,6 @@ int RscpReader_Year(const char * user, const char *pw, const char *aes, const ch
 	aes_password = aes;
 	ip_addr = ip;
 	port_number = port;
-	spanTag = TAG_DB_REQ_HISTORY_DATA_YEAR;
-	// only the sum of the year makes sense, month do not have equal length
-	start.seconds = mktime(l);
-	start.nanoseconds = 0;
-
-	interval.nanoseconds = 0;
-	l->tm_year++;
-	span.seconds = mktime(l) - start.seconds - 1;
-	span.nanoseconds = 0;
-	interval.seconds = span.seconds; // does not matter, only sum is valid
+	history_queue(history_year, &tm::tm_year, l, count);
 	return RscpReader();
 }
@@ -0,0 +1,78 @@
+//============================================================================
+// Name        : RscpRetry.cpp
+// Description : Backoff with jitter and circuit breaker for reconnects
+//============================================================================
+
+#include "RscpRetry.h"
+
+RscpBackoff::RscpBackoff(uint32_t seed) :
+		state((seed != 0) ? seed : 1) {
+}
+
+uint32_t RscpBackoff::getDelay(const SRscpRetryPolicy & policy, uint32_t retry) {
+	uint64_t delay = policy.baseDelayMs;
+	for (uint32_t i = 1; (i < retry) && (delay < policy.maxDelayMs); i++) {
+		delay *= 2;
+	}
+	if (delay > policy.maxDelayMs) {
+		delay = policy.maxDelayMs;
+	}
+	return jitter((uint32_t) delay);
+}
+
+uint32_t RscpBackoff::jitter(uint32_t delay) {
+	// xorshift32, good enough to spread the retries
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	// 75% .. 125% of the delay
+	uint32_t spread = delay / 2;
+	return delay - delay / 4 + ((spread > 0) ? state % (spread + 1) : 0);
+}
+
+RscpCircuitBreaker::RscpCircuitBreaker() {
+	reset();
+}
+
+void RscpCircuitBreaker::reset() {
+	state = eStateClosed;
+	failures = 0;
+	windowStart = 0;
+	openUntil = 0;
+}
+
+void RscpCircuitBreaker::failure(const SRscpRetryPolicy & policy, uint64_t now) {
+	if (policy.breakerFailures == 0) {
+		return;
+	}
+	if ((state == eStateClosed) && (now - windowStart > policy.breakerWindowMs)) {
+		// the failures before are too long ago
+		windowStart = now;
+		failures = 0;
+	}
+	failures++;
+	if ((state == eStateHalfOpen) || (failures >= policy.breakerFailures)) {
+		state = eStateOpen;
+		openUntil = now + policy.breakerWindowMs;
+	}
+}
+
+void RscpCircuitBreaker::success() {
+	if (state != eStateClosed) {
+		state = eStateClosed;
+		failures = 0;
+	}
+}
+
+uint32_t RscpCircuitBreaker::getWait(uint64_t now) const {
+	if ((state != eStateOpen) || (now >= openUntil)) {
+		return 0;
+	}
+	return (uint32_t) (openUntil - now);
+}
+
+void RscpCircuitBreaker::attempt() {
+	if (state == eStateOpen) {
+		state = eStateHalfOpen;
+	}
+}
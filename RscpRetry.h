@@ -0,0 +1,88 @@
+//============================================================================
+// Name        : RscpRetry.h
+// Description : When and how often a failed connection is tried again:
+//             : exponential backoff with jitter and a circuit breaker per
+//             : S10 that pauses a device which keeps failing.
+//============================================================================
+
+#ifndef RSCPRETRY_H_
+#define RSCPRETRY_H_
+
+#include <stdint.h>
+
+struct SRscpRetryPolicy {
+	uint32_t maxRetries;        // retries after a failure without a new response in between, 0 = no retry
+	uint32_t baseDelayMs;       // delay before the first retry, doubled for each further one
+	uint32_t maxDelayMs;        // upper limit of the delay
+	uint32_t breakerFailures;   // failures within breakerWindowMs that open the circuit, 0 = no circuit breaker;
+	                            // at most maxRetries, else a S10 that fails every time is given up first
+	uint32_t breakerWindowMs;   // the circuit stays open as long, then one attempt is let through
+};
+
+// 3 retries after 1, 2 and 4 seconds (each +-25%); 3 failures within 30 seconds pause the S10 for 30 to 45 seconds,
+// so the last retry of a S10 that fails every time waits at least 30 seconds instead of 4
+#define RSCP_RETRY_DEFAULT { 3, 1000, 30000, 3, 30000 }
+
+/*
+ * Exponential backoff with jitter: the n-th delay is base * 2^(n-1), at most the maximum,
+ * randomly 25% shorter or longer, so that many S10s that failed together do not retry together.
+ */
+class RscpBackoff {
+public:
+	RscpBackoff(uint32_t seed = 1);
+	/*
+	 * \brief Delay in milliseconds before retry \var retry (1 = first retry).
+	 */
+	uint32_t getDelay(const SRscpRetryPolicy & policy, uint32_t retry);
+	/*
+	 * \brief \var delay randomly 25% shorter or longer.
+	 */
+	uint32_t jitter(uint32_t delay);
+
+private:
+	uint32_t state;     // xorshift state, never 0
+};
+
+/*
+ * Circuit breaker of one S10. Closed: every attempt is allowed. After breakerFailures failures within
+ * breakerWindowMs it opens: no attempt until breakerWindowMs after the last failure, then half open:
+ * one attempt is let through. If it gets a response the circuit closes, if it fails it opens again.
+ */
+class RscpCircuitBreaker {
+public:
+	enum eState {
+		eStateClosed,
+		eStateOpen,
+		eStateHalfOpen
+	};
+
+	RscpCircuitBreaker();
+	void reset();
+	eState getState() const {
+		return state;
+	}
+	/*
+	 * \brief An attempt failed at \var now (milliseconds, RscpTimerWheel::now()).
+	 */
+	void failure(const SRscpRetryPolicy & policy, uint64_t now);
+	/*
+	 * \brief An attempt got a response.
+	 */
+	void success();
+	/*
+	 * \brief Milliseconds until the next attempt is allowed, 0 if the circuit is not open.
+	 */
+	uint32_t getWait(uint64_t now) const;
+	/*
+	 * \brief A new attempt starts, an open circuit becomes half open.
+	 */
+	void attempt();
+
+private:
+	eState state;
+	uint32_t failures;      // failures since windowStart
+	uint64_t windowStart;
+	uint64_t openUntil;
+};
+
+#endif /* RSCPRETRY_H_ */
@@ -0,0 +1,98 @@
+//============================================================================
+// Name        : RscpRingBuffer.cpp
+// Description : Receive buffer of one connection as a mirrored ring
+//============================================================================
+
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "RscpRingBuffer.h"
+
+RscpRingBuffer::RscpRingBuffer() :
+		base(NULL), capacity(0), readPos(0), used(0), mirrored(false) {
+}
+
+RscpRingBuffer::~RscpRingBuffer() {
+	unmap();
+}
+
+uint8_t * RscpRingBuffer::mapMirrored(uint32_t size) {
+	int fd = memfd_create("rscp-ring", MFD_CLOEXEC);
+	if (fd < 0) {
+		return NULL;
+	}
+	uint8_t * mapping = NULL;
+	if (ftruncate(fd, size) == 0) {
+		// reserve the address range, then put the same pages into both halves
+		void * area = mmap(NULL, 2 * (size_t) size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (area != MAP_FAILED) {
+			mapping = (uint8_t *) area;
+			if ((mmap(mapping, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+					|| (mmap(mapping + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)) {
+				munmap(area, 2 * (size_t) size);
+				mapping = NULL;
+			}
+		}
+	}
+	// the mappings keep the memory
+	close(fd);
+	return mapping;
+}
+
+void RscpRingBuffer::unmap() {
+	if (base != NULL) {
+		munmap(base, 2 * (size_t) capacity);
+		base = NULL;
+	}
+}
+
+bool RscpRingBuffer::reserve(uint32_t size) {
+	if (size <= capacity) {
+		return true;
+	}
+	// whole pages for the mirror, a power of 2 so that the ring grows only a few times
+	uint32_t newCapacity = (uint32_t) sysconf(_SC_PAGESIZE);
+	while (newCapacity < size) {
+		newCapacity *= 2;
+	}
+	bool newMirrored = true;
+	uint8_t * newBase = mapMirrored(newCapacity);
+	if (newBase == NULL) {
+		newMirrored = false;
+		void * area = mmap(NULL, 2 * (size_t) newCapacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (area == MAP_FAILED) {
+			return false;
+		}
+		newBase = (uint8_t *) area;
+	}
+	if (used > 0) {
+		memcpy(newBase, getData(), used);
+	}
+	unmap();
+	base = newBase;
+	capacity = newCapacity;
+	readPos = 0;
+	mirrored = newMirrored;
+	return true;
+}
+
+void RscpRingBuffer::consume(uint32_t length) {
+	if (length > used) {
+		length = used;
+	}
+	used -= length;
+	readPos += length;
+	if (used == 0) {
+		// start at the front again, the next bytes need not wrap
+		readPos = 0;
+	} else if (readPos >= capacity) {
+		if (mirrored) {
+			// the same bytes are at the front
+			readPos -= capacity;
+		} else {
+			// the space behind the bytes would be less than the capacity
+			memmove(base, base + readPos, used);
+			readPos = 0;
+		}
+	}
+}
@@ -0,0 +1,92 @@
+//============================================================================
+// Name        : RscpRingBuffer.h
+// Description : Receive buffer of one connection as a ring. The memory is
+//             : mapped twice back to back, so the bytes in the ring and the
+//             : free space behind them are always contiguous: frames are
+//             : parsed in place across the end of the ring and the bytes
+//             : behind a frame never have to be moved to the front.
+//============================================================================
+
+#ifndef RSCPRINGBUFFER_H_
+#define RSCPRINGBUFFER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+class RscpRingBuffer {
+public:
+	RscpRingBuffer();
+	~RscpRingBuffer();
+    /*
+     * \brief Make room for at least \var capacity bytes; the capacity is rounded up to a power of 2 of at least
+     *        one page. The ring only grows, and only if it is smaller: the bytes in it are copied once then.
+     * @return - false if no memory could be mapped, the ring is unchanged then
+     */
+	bool reserve(uint32_t capacity);
+    /*
+     * \brief Drop all bytes, the memory is kept.
+     */
+	void clear() {
+		readPos = 0;
+		used = 0;
+	}
+    /*
+     * \brief The bytes in the ring, contiguous from getData() on.
+     */
+	uint8_t * getData() const {
+		return base + readPos;
+	}
+	uint32_t size() const {
+		return used;
+	}
+    /*
+     * \brief The free space behind the bytes, contiguous from getSpace() on.
+     */
+	uint8_t * getSpace() const {
+		return base + readPos + used;
+	}
+	uint32_t getSpaceSize() const {
+		return capacity - used;
+	}
+	uint32_t getCapacity() const {
+		return capacity;
+	}
+    /*
+     * \brief \var length bytes were written to getSpace().
+     */
+	void produce(uint32_t length) {
+		used += length;
+	}
+    /*
+     * \brief The first \var length bytes are processed.
+     */
+	void consume(uint32_t length);
+    /*
+     * \brief The whole mapping the pointers above point into (2 * capacity bytes), e.g. to register it with the kernel.
+     *        It only moves when reserve() grows the ring.
+     */
+	uint8_t * getMapping(uint32_t & length) const {
+		length = 2 * capacity;
+		return base;
+	}
+    /*
+     * \brief Whether the memory is mapped twice. Without memfd_create() it is a plain buffer of 2 * capacity bytes
+     *        and the bytes are moved to the front when the read position passes the capacity.
+     */
+	bool isMirrored() const {
+		return mirrored;
+	}
+
+private:
+	// map \var size bytes twice back to back, NULL if not possible
+	static uint8_t * mapMirrored(uint32_t size);
+	void unmap();
+
+	uint8_t * base;
+	uint32_t capacity;
+	uint32_t readPos;   // < capacity
+	uint32_t used;      // <= capacity
+	bool mirrored;
+};
+
+#endif /* RSCPRINGBUFFER_H_ */
@@ -0,0 +1,298 @@
+//============================================================================
+// Name        : RscpSession.cpp
+// Description : Protocol state of one connection to a S10
+//============================================================================
+
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+#include "RscpSession.h"
+#include "RscpTags.h"
+#include "RscpTagSchema.h"
+#include "RscpTimerWheel.h"
+
+// free receive space handed to the transport
+#define RSCP_RECEIVE_SPACE 4096
+
+void RscpSessionHandler::request(RscpSession & session, const SRscpHistoryRequest & request, size_t index, RscpFrameWriter & writer) {
+	writer.openContainer(request.spanTag);
+	writer.appendValue(TAG_DB_REQ_HISTORY_TIME_START, request.start);
+	writer.appendValue(TAG_DB_REQ_HISTORY_TIME_INTERVAL, request.interval);
+	writer.appendValue(TAG_DB_REQ_HISTORY_TIME_SPAN, request.span);
+	writer.closeContainer();
+}
+
+RscpSession::RscpSession(RscpSessionHandler & handler) :
+		handler(handler), port(0), state(eStateIdle), error(0), authenticated(false), nextRequest(0), nextResponse(0), retryEnabled(false), retries(0), retryDelay(
+				0), decryptedBytes(0), sendPos(0), encryptedEnd(0) {
+}
+
+void RscpSession::setDevice(const char * ip, int port, const char * user, const char * password, const char * aesPassword) {
+	this->ip = ip;
+	this->port = port;
+	this->user = user;
+	this->password = password;
+	this->aesPassword = aesPassword;
+	char buffer[16];
+	snprintf(buffer, sizeof(buffer), ":%d", port);
+	name = this->ip + buffer;
+	// every S10 gets its own jitter
+	uint32_t seed = (uint32_t) RscpTimerWheel::now();
+	for (size_t i = 0; i < name.size(); i++) {
+		seed = seed * 31 + (uint8_t) name[i];
+	}
+	backoff = RscpBackoff(seed);
+}
+
+void RscpSession::setRequests(const std::vector<SRscpHistoryRequest> & requests) {
+	this->requests = requests;
+	nextResponse = 0;
+	retries = 0;
+	breaker.reset();
+}
+
+void RscpSession::setRetryPolicy(const SRscpRetryPolicy & policy) {
+	retryPolicy = policy;
+	retryEnabled = (policy.maxRetries > 0);
+}
+
+void RscpSession::connecting() {
+	if (state == eStateBackoff) {
+		breaker.attempt();
+	}
+	state = eStateConnecting;
+	error = 0;
+	authenticated = false;
+	// the answered reports are done, the others are requested (again)
+	nextRequest = nextResponse;
+	cipher.init(aesPassword.c_str());
+	parser.reset();
+	values.clear();
+	ring.clear();
+	decryptedBytes = 0;
+	sendBuffer.clear();
+	sendPos = 0;
+	encryptedEnd = 0;
+}
+
+void RscpSession::connected() {
+	if (state != eStateConnecting) {
+		return;
+	}
+	// authenticate once per connection
+	RscpFrameWriter writer(frameBuffer);
+	writer.openContainer(TAG_RSCP_REQ_AUTHENTICATION);
+	writer.appendValue(TAG_RSCP_AUTHENTICATION_USER, user);
+	writer.appendValue(TAG_RSCP_AUTHENTICATION_PASSWORD, password);
+	writer.closeContainer();
+	if (writer.finishFrame(protocol, true, AES_BLOCK_SIZE) != RSCP::OK) {
+		fail(EINVAL);
+		return;
+	}
+	queueFrame();
+	state = eStateAuthenticating;
+}
+
+void RscpSession::fail(int errorCode) {
+	if (!isActive()) {
+		return;
+	}
+	bool retry = retryEnabled && isTransient(errorCode);
+	uint64_t now = RscpTimerWheel::now();
+	if (retry) {
+		// every failure counts, also the last one, so that a S10 failing again and again opens the circuit
+		breaker.failure(retryPolicy, now);
+	}
+	if (retry && (retries < retryPolicy.maxRetries)) {
+		retries++;
+		retryDelay = backoff.getDelay(retryPolicy, retries);
+		// an open circuit waits longer; the pause gets the jitter too, moved up by 25% so that it does not end
+		// before the circuit is half open, else S10s whose circuits opened together would connect together
+		uint32_t wait = breaker.getWait(now);
+		if (wait > retryDelay) {
+			retryDelay = backoff.jitter(wait) + wait / 4;
+		}
+		state = eStateBackoff;
+		error = errorCode;
+		handler.retrying(*this, errorCode, retryDelay);
+		return;
+	}
+	finish(eStateFailed, errorCode);
+}
+
+void RscpSession::abort(int errorCode) {
+	if (isActive() || (state == eStateBackoff)) {
+		finish(eStateFailed, errorCode);
+	}
+}
+
+bool RscpSession::isTransient(int errorCode) {
+	switch (errorCode) {
+	case EACCES:        // login refused
+	case EINVAL:        // request or address invalid
+	case ENOMEM:
+	case ENOSYS:        // transport not available
+	case EPROTO:        // the S10 does not answer with RSCP, e.g. wrong AES password
+		return false;
+	default:
+		// timeouts, refused or reset connections, damaged frames
+		return true;
+	}
+}
+
+void RscpSession::finish(eState endState, int errorCode) {
+	state = endState;
+	error = errorCode;
+	handler.finished(*this, errorCode);
+}
+
+void RscpSession::queueFrame() {
+	sendBuffer.insert(sendBuffer.end(), frameBuffer.begin(), frameBuffer.end());
+}
+
+void RscpSession::queueRequests() {
+	while ((nextRequest < requests.size()) && (nextRequest - nextResponse < RSCP_PIPELINE_DEPTH)) {
+		RscpFrameWriter writer(frameBuffer);
+		handler.request(*this, requests[nextRequest], nextRequest, writer);
+		if (writer.finishFrame(protocol, true, AES_BLOCK_SIZE) != RSCP::OK) {
+			fail(EINVAL);
+			return;
+		}
+		queueFrame();
+		nextRequest++;
+	}
+}
+
+void RscpSession::frameComplete() {
+	if (state == eStateAuthenticating) {
+		if (!authenticated) {
+			fail(EACCES);
+			return;
+		}
+		state = eStateRequesting;
+	} else if (nextResponse < nextRequest) {
+		nextResponse++;
+		// a response: the S10 is fine again
+		retries = 0;
+		breaker.success();
+	}
+	if (nextResponse == requests.size()) {
+		finish(eStateDone, 0);
+		return;
+	}
+	queueRequests();
+}
+
+bool RscpSession::reserve(uint32_t size) {
+	const uint8_t * before = ring.getData();
+	if (!ring.reserve(size)) {
+		return false;
+	}
+	// the ring keeps the bytes at the same offset from getData()
+	const uint8_t * after = ring.getData();
+	if (after != before) {
+		for (size_t i = 0; i < values.size(); i++) {
+			if (values[i].data != NULL) {
+				values[i].data = (uint8_t *) after + (values[i].data - before);
+			}
+		}
+	}
+	return true;
+}
+
+uint8_t * RscpSession::getReceiveSpace(uint32_t & length) {
+	// the ring is sized for the current frame when its header arrives, this only grows it for the first bytes
+	if ((ring.getSpaceSize() < RSCP_RECEIVE_SPACE) && !reserve(ring.size() + RSCP_RECEIVE_SPACE)) {
+		fail(ENOMEM);
+		length = 0;
+		return NULL;
+	}
+	length = ring.getSpaceSize();
+	return ring.getSpace();
+}
+
+bool RscpSession::received(uint32_t length) {
+	if (!isActive()) {
+		return false;
+	}
+	ring.produce(length);
+
+	// decrypt the new complete blocks in place, the IV continues from the last decrypted block
+	uint32_t uiLength = ROUNDDOWN(ring.size() - decryptedBytes, AES_BLOCK_SIZE);
+	if (uiLength > 0) {
+		uint8_t * blocks = ring.getData() + decryptedBytes;
+		cipher.decrypt(blocks, blocks, uiLength);
+		decryptedBytes += uiLength;
+	}
+
+	// process all received frames, the responses come in the order of the requests
+	while (isActive() && (decryptedBytes > 0)) {
+		// zero copy: all values point into the ring, they are kept until their frame is complete
+		int32_t iResult = parser.parse(ring.getData(), decryptedBytes, values);
+		if (iResult < 0) {
+			values.clear();
+			if ((state == eStateAuthenticating) && (iResult != RSCP::ERR_INVALID_CRC)) {
+				// not even the first frame is RSCP: trying again would not help
+				fail(EPROTO);
+			} else {
+				// a damaged frame
+				fail(EBADMSG);
+			}
+			break;
+		}
+		if (iResult == 0) {
+			// not enough data of the frame received: make room for all of it once, the header has its length
+			int32_t iFrameLength = protocol.getFrameLength(ring.getData(), decryptedBytes);
+			if ((iFrameLength > 0) && !reserve(ROUNDUP((uint32_t ) iFrameLength, AES_BLOCK_SIZE) + RSCP_RECEIVE_SPACE)) {
+				fail(ENOMEM);
+			}
+			break;
+		}
+		// the frame is complete and its CRC is correct
+		const SRscpHistoryRequest * request = NULL;
+		if ((state == eStateRequesting) && (nextResponse < nextRequest)) {
+			request = &requests[nextResponse];
+		}
+		for (size_t i = 0; i < values.size(); i++) {
+			if ((state == eStateAuthenticating) && (values[i].tag == TAG_RSCP_AUTHENTICATION)) {
+				// a refused login is an error value (e.g. RSCP_ERR_ACCESS_DENIED), not an access level
+				authenticated = (values[i].dataType == RSCP::eTypeUChar8) && (protocol.get<TAG_RSCP_AUTHENTICATION>(&values[i]) > 0);
+			}
+			handler.value(*this, request, values[i]);
+		}
+		values.clear();
+		// the processed bytes do not include the zero padding; the bytes behind the frame stay where they are
+		uint32_t uiProcessed = ROUNDUP((uint32_t ) iResult, AES_BLOCK_SIZE);
+		if (uiProcessed > decryptedBytes) {
+			uiProcessed = decryptedBytes;
+		}
+		ring.consume(uiProcessed);
+		decryptedBytes -= uiProcessed;
+		frameComplete();
+	}
+	return isActive();
+}
+
+uint8_t * RscpSession::getPlainData(uint32_t & length) {
+	length = sendBuffer.size() - encryptedEnd;
+	return (length > 0) ? &sendBuffer[0] + encryptedEnd : NULL;
+}
+
+void RscpSession::encrypted() {
+	encryptedEnd = sendBuffer.size();
+}
+
+const uint8_t * RscpSession::getSendData(uint32_t & length) const {
+	length = encryptedEnd - sendPos;
+	return (length > 0) ? &sendBuffer[0] + sendPos : NULL;
+}
+
+void RscpSession::sent(uint32_t length) {
+	sendPos += length;
+	if (sendPos == sendBuffer.size()) {
+		// all out, the buffer keeps its capacity for the next requests
+		sendBuffer.clear();
+		sendPos = 0;
+		encryptedEnd = 0;
+	}
+}
@@ -0,0 +1,240 @@
+//============================================================================
+// Name        : RscpSession.h
+// Description : Protocol state of one connection to a S10: authentication,
+//             : pipelined history requests and the received frames. It does
+//             : no I/O itself, a transport (e.g. RscpEventLoop) moves the
+//             : bytes, so many sessions can run in one thread.
+//============================================================================
+
+#ifndef RSCPSESSION_H_
+#define RSCPSESSION_H_
+
+#include <string>
+#include <vector>
+#include "RscpTypes.h"
+#include "RscpCipher.h"
+#include "RscpFrameParser.h"
+#include "RscpFrameWriter.h"
+#include "RscpRingBuffer.h"
+#include "RscpRetry.h"
+
+// history requests of one session on the way at the same time
+#define RSCP_PIPELINE_DEPTH 8
+
+// one report: the span and times of a history request
+struct SRscpHistoryRequest {
+	SRscpTag spanTag;
+	SRscpTimestamp start, interval, span;
+};
+
+class RscpSession;
+
+/*
+ * Callbacks of RscpSession, called from the transport's thread.
+ */
+class RscpSessionHandler {
+public:
+	virtual ~RscpSessionHandler() {
+	}
+	/*
+	 * \brief Write the values of report \var index into the request frame.
+	 *        The default writes the history request container of \var request.
+	 */
+	virtual void request(RscpSession & session, const SRscpHistoryRequest & request, size_t index, RscpFrameWriter & writer);
+	/*
+	 * \brief A top level value of a response. The values of a frame are handed over when the whole frame
+	 *        is received and its CRC is correct, so a damaged or incomplete frame hands over nothing.
+	 *        The value points into the receive buffer and is only valid during the call.
+	 * @param request - The report the frame answers, NULL for the answer to the authentication
+	 */
+	virtual void value(RscpSession & session, const SRscpHistoryRequest * request, const SRscpValue & value) = 0;
+	/*
+	 * \brief The session ended, the transport closes the connection.
+	 * @param error - 0 if all reports were received, else an errno value (e.g. ETIMEDOUT, EACCES)
+	 */
+	virtual void finished(RscpSession & session, int error) {
+	}
+	/*
+	 * \brief The connection failed with \var error, the transport connects again in \var delayMs milliseconds.
+	 *        Only the reports that are not answered yet are requested then.
+	 *        The delay is longer if the circuit breaker of the S10 is open, see getBreakerState().
+	 */
+	virtual void retrying(RscpSession & session, int error, uint32_t delayMs) {
+	}
+};
+
+class RscpSession {
+public:
+	enum eState {
+		eStateIdle,             // not started
+		eStateConnecting,       // waiting for the TCP connection
+		eStateAuthenticating,   // authentication sent, waiting for the answer
+		eStateRequesting,       // history requests and responses on the way
+		eStateDone,             // all reports received
+		eStateFailed,           // ended with an error, see getError()
+		eStateBackoff           // the connection failed, waiting getRetryDelay() to connect again
+	};
+
+	RscpSession(RscpSessionHandler & handler);
+	/*
+	 * \brief Address and credentials of the S10, the strings are copied.
+	 */
+	void setDevice(const char * ip, int port, const char * user, const char * password, const char * aesPassword);
+	/*
+	 * \brief The reports to request, in this order. Up to RSCP_PIPELINE_DEPTH are requested at the same time.
+	 */
+	void setRequests(const std::vector<SRscpHistoryRequest> & requests);
+	/*
+	 * \brief Connect again after a failed connection, see SRscpRetryPolicy. Without a policy a failure ends the session.
+	 */
+	void setRetryPolicy(const SRscpRetryPolicy & policy);
+
+	const char * getIp() const {
+		return ip.c_str();
+	}
+	int getPort() const {
+		return port;
+	}
+	// "ip:port" for messages
+	const char * getName() const {
+		return name.c_str();
+	}
+	eState getState() const {
+		return state;
+	}
+	bool isFinished() const {
+		return (state == eStateDone) || (state == eStateFailed);
+	}
+	// connecting or connected, not finished and not waiting for a retry
+	bool isActive() const {
+		return (state == eStateConnecting) || (state == eStateAuthenticating) || (state == eStateRequesting);
+	}
+	int getError() const {
+		return error;
+	}
+	// milliseconds the transport waits in eStateBackoff before it connects again
+	uint32_t getRetryDelay() const {
+		return retryDelay;
+	}
+	RscpCircuitBreaker::eState getBreakerState() const {
+		return breaker.getState();
+	}
+
+    /*
+     * \brief The transport starts to connect: all state of a previous connection is dropped.
+     *        After a failure the reports already answered are not requested again.
+     */
+	void connecting();
+    /*
+     * \brief The connection is established, the authentication frame is queued for sending.
+     */
+	void connected();
+    /*
+     * \brief The connection failed with \var errorCode (errno value), e.g. a socket error or a timeout.
+     *        If the retry policy allows another attempt the session goes to eStateBackoff and calls
+     *        RscpSessionHandler::retrying(), else it ends and calls RscpSessionHandler::finished().
+     *        Every transient failure counts for the circuit breaker, also the one that ends the session.
+     *        Nothing happens if the session has already finished or waits for a retry.
+     */
+	void fail(int errorCode);
+    /*
+     * \brief End the session with \var errorCode without a retry, e.g. when the transport can not go on.
+     */
+	void abort(int errorCode);
+
+    /*
+     * \brief Free space for received (encrypted) bytes, at least 4096 bytes.
+     * @param length - Returns the number of bytes that fit
+     * @return       - Where the transport writes the received bytes, NULL if the session failed (no memory)
+     */
+	uint8_t * getReceiveSpace(uint32_t & length);
+    /*
+     * \brief The whole buffer getReceiveSpace() points into, e.g. to register it with the kernel.
+     *        It only moves when the ring has to grow for a larger frame.
+     */
+	uint8_t * getReceiveBuffer(uint32_t & capacity) {
+		return ring.getMapping(capacity);
+	}
+    /*
+     * \brief \var length bytes were written to the receive space: decrypt the complete blocks, hand the
+     *        values of the complete frames to the handler and queue the next requests.
+     *        Data that is not RSCP before the first frame of the connection fails it with EPROTO (e.g. a wrong
+     *        AES password, not retried), a damaged frame later with EBADMSG.
+     * @return - false if the session has finished (done or failed) or waits for a retry
+     */
+	bool received(uint32_t length);
+
+    /*
+     * \brief Queued plain frames that are not encrypted yet. The transport encrypts them with getCipher(),
+     *        several sessions at once with RscpCipher::encrypt(), and then calls encrypted().
+     * @param length - Returns the number of bytes, a multiple of AES_BLOCK_SIZE
+     * @return       - The plain frames, encrypted in place
+     */
+	uint8_t * getPlainData(uint32_t & length);
+	void encrypted();
+	RscpCipher & getCipher() {
+		return cipher;
+	}
+    /*
+     * \brief Encrypted bytes that are not sent yet; the transport reports what went out with sent().
+     */
+	const uint8_t * getSendData(uint32_t & length) const;
+	void sent(uint32_t length);
+	bool wantsToSend() const {
+		return sendPos < encryptedEnd;
+	}
+
+private:
+	// queue the next history requests up to RSCP_PIPELINE_DEPTH
+	void queueRequests();
+	// queue the frame in frameBuffer for sending
+	void queueFrame();
+	// the frame of the oldest open request is complete
+	void frameComplete();
+	void finish(eState endState, int errorCode);
+	// grow the ring to \var size bytes, the values of the current frame move with the received bytes
+	bool reserve(uint32_t size);
+	// whether a connection failing with \var errorCode is worth another attempt
+	static bool isTransient(int errorCode);
+
+	RscpSessionHandler & handler;
+	std::string ip;
+	int port;
+	std::string name;
+	std::string user;
+	std::string password;
+	std::string aesPassword;
+	eState state;
+	int error;
+	bool authenticated;
+
+	RscpCipher cipher;
+	RscpProtocol protocol;
+	RscpFrameParser parser;
+	std::vector<SRscpValue> values;     // values of the current frame, handed over when it is complete
+
+	std::vector<SRscpHistoryRequest> requests;
+	size_t nextRequest;     // next report to request
+	size_t nextResponse;    // report of the next response frame
+
+	bool retryEnabled;
+	SRscpRetryPolicy retryPolicy;
+	uint32_t retries;       // failures since the last response
+	uint32_t retryDelay;
+	RscpBackoff backoff;
+	RscpCircuitBreaker breaker;
+
+	// the received bytes: the plain text of the received blocks, starting with the current frame, followed by
+	// the encrypted bytes that do not make a full block yet; the frames are decrypted and parsed in place
+	RscpRingBuffer ring;
+	uint32_t decryptedBytes;
+
+	// one frame is built here and then appended to sendBuffer
+	std::vector<uint8_t> frameBuffer;
+	// sent bytes, encrypted bytes not sent yet, plain frames not encrypted yet
+	std::vector<uint8_t> sendBuffer;
+	uint32_t sendPos;
+	uint32_t encryptedEnd;
+};
+
+#endif /* RSCPSESSION_H_ */
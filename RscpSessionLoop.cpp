@@ -0,0 +1,78 @@
+//============================================================================
+// Name        : RscpSessionLoop.cpp
+// Description : Batched encryption and timers of the session loops
+//============================================================================
+
+#include <errno.h>
+#include "RscpSessionLoop.h"
+
+RscpSessionLoop::RscpSessionLoop() :
+		timeoutMs(10000) {
+}
+
+void RscpSessionLoop::init(SSessionConnection * connection, RscpSession * session) {
+	connection->session = session;
+	connection->pending = false;
+	connection->waiting = false;
+	RscpTimerWheel::init(&connection->timer, connection);
+}
+
+void RscpSessionLoop::queueFrames(SSessionConnection * connection) {
+	uint32_t length;
+	if ((connection->session->getPlainData(length) != NULL) && !connection->pending) {
+		connection->pending = true;
+		pending.push_back(connection);
+	}
+}
+
+void RscpSessionLoop::flush() {
+	ciphers.clear();
+	data.clear();
+	lengths.clear();
+	for (size_t i = 0; i < pending.size(); i++) {
+		SSessionConnection * connection = pending[i];
+		connection->pending = false;
+		uint32_t length;
+		uint8_t * plain = connection->session->getPlainData(length);
+		if (isOpen(connection) && (plain != NULL)) {
+			ciphers.push_back(&connection->session->getCipher());
+			data.push_back(plain);
+			lengths.push_back(length);
+		}
+	}
+	if (ciphers.size() > 0) {
+		RscpCipher::encrypt(&ciphers[0], &data[0], &lengths[0], ciphers.size());
+	}
+	for (size_t i = 0; i < pending.size(); i++) {
+		SSessionConnection * connection = pending[i];
+		if (isOpen(connection)) {
+			connection->session->encrypted();
+			sendFrames(connection);
+		}
+	}
+	pending.clear();
+}
+
+bool RscpSessionLoop::waitForRetry(SSessionConnection * connection) {
+	RscpSession * session = connection->session;
+	if (session->getState() != RscpSession::eStateBackoff) {
+		return false;
+	}
+	connection->waiting = true;
+	wheel.schedule(&connection->timer, RscpTimerWheel::now(), session->getRetryDelay());
+	return true;
+}
+
+void RscpSessionLoop::expireTimers() {
+	expired.clear();
+	wheel.advance(RscpTimerWheel::now(), expired);
+	for (size_t i = 0; i < expired.size(); i++) {
+		SSessionConnection * connection = (SSessionConnection *) expired[i]->owner;
+		if (connection->waiting) {
+			connection->waiting = false;
+			reconnect(connection);
+		} else {
+			closeConnection(connection, ETIMEDOUT);
+		}
+	}
+}
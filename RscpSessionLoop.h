@@ -0,0 +1,71 @@
+//============================================================================
+// Name        : RscpSessionLoop.h
+// Description : What RscpEventLoop and RscpUringLoop have in common: the
+//             : request frames of all sessions that are ready are
+//             : encrypted together with the multi stream cipher, and the
+//             : timer wheel ends connections that time out and connects
+//             : the sessions waiting for a retry again. The transports
+//             : only tell whether a connection is open and how to send,
+//             : connect and close.
+//============================================================================
+
+#ifndef RSCPSESSIONLOOP_H_
+#define RSCPSESSIONLOOP_H_
+
+#include <vector>
+#include "RscpSession.h"
+#include "RscpTimerWheel.h"
+
+class RscpSessionLoop {
+public:
+	RscpSessionLoop();
+	virtual ~RscpSessionLoop() {
+	}
+    /*
+     * \brief Timeout for the connect and for the next bytes of a response, 10 seconds by default.
+     */
+	void setTimeout(uint32_t ms) {
+		timeoutMs = ms;
+	}
+
+protected:
+	// the part of a connection the transports share, their connections are derived from it
+	struct SSessionConnection {
+		RscpSession * session;
+		bool pending;       // in the list of sessions with frames to encrypt
+		bool waiting;       // no socket, the timer connects again
+		SRscpTimer timer;   // timeout of the connection resp. end of the retry delay
+	};
+
+	void init(SSessionConnection * connection, RscpSession * session);
+	// the session of \var connection may have queued frames, flush() encrypts and sends them
+	void queueFrames(SSessionConnection * connection);
+	// encrypt the queued frames of all sessions at once and send them
+	void flush();
+	// the socket of \var connection is gone: true if the session waits for a retry, the timer is set then
+	bool waitForRetry(SSessionConnection * connection);
+	// close the connections that did not receive anything in time, connect those that waited long enough for a retry
+	void expireTimers();
+
+	// the connection has a socket and is not closing
+	virtual bool isOpen(const SSessionConnection * connection) const = 0;
+	// send the encrypted bytes of the session
+	virtual void sendFrames(SSessionConnection * connection) = 0;
+	// connect again after the retry delay
+	virtual void reconnect(SSessionConnection * connection) = 0;
+	// end the session with \var error unless it has finished already
+	virtual void closeConnection(SSessionConnection * connection, int error) = 0;
+
+	uint32_t timeoutMs;
+	RscpTimerWheel wheel;
+
+private:
+	std::vector<SRscpTimer *> expired;
+	// sessions with frames queued during the current round of events
+	std::vector<SSessionConnection *> pending;
+	std::vector<RscpCipher *> ciphers;
+	std::vector<uint8_t *> data;
+	std::vector<uint32_t> lengths;
+};
+
+#endif /* RSCPSESSIONLOOP_H_ */
@@ -0,0 +1,857 @@
+//============================================================================
+// Name        : RscpTagSchema.h
+// Description : Name, namespace and data type of the RSCP tags.
+//             : Generated by gen_tag_schema.py from RscpTags.h - do not edit.
+//============================================================================
+
+#ifndef RSCPTAGSCHEMA_H_
+#define RSCPTAGSCHEMA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "RscpTypes.h"
+#include "RscpTags.h"
+
+// data type of the tags whose type is not known
+#define RSCP_TYPE_UNKNOWN           0xFE
+
+struct SRscpTagInfo {
+	SRscpTag tag;
+	uint8_t dataType;
+	const char * name;
+};
+
+namespace RscpTagSchema {
+
+// all tags, sorted by tag
+constexpr SRscpTagInfo tags[] = {
+	{ TAG_RSCP_REQ_AUTHENTICATION, RSCP::eTypeContainer, "TAG_RSCP_REQ_AUTHENTICATION" },
+	{ TAG_RSCP_AUTHENTICATION_USER, RSCP::eTypeString, "TAG_RSCP_AUTHENTICATION_USER" },
+	{ TAG_RSCP_AUTHENTICATION_PASSWORD, RSCP::eTypeString, "TAG_RSCP_AUTHENTICATION_PASSWORD" },
+	{ TAG_RSCP_REQ_USER_LEVEL, RSCP_TYPE_UNKNOWN, "TAG_RSCP_REQ_USER_LEVEL" },
+	{ TAG_RSCP_REQ_SET_ENCRYPTION_PASSPHRASE, RSCP_TYPE_UNKNOWN, "TAG_RSCP_REQ_SET_ENCRYPTION_PASSPHRASE" },
+	{ TAG_RSCP_AUTHENTICATION, RSCP::eTypeUChar8, "TAG_RSCP_AUTHENTICATION" },
+	{ TAG_RSCP_USER_LEVEL, RSCP_TYPE_UNKNOWN, "TAG_RSCP_USER_LEVEL" },
+	{ TAG_RSCP_SET_ENCRYPTION_PASSPHRASE, RSCP_TYPE_UNKNOWN, "TAG_RSCP_SET_ENCRYPTION_PASSPHRASE" },
+	{ TAG_RSCP_GENERAL_ERROR, RSCP::eTypeError, "TAG_RSCP_GENERAL_ERROR" },
+	{ TAG_EMS_REQ_POWER_PV, RSCP::eTypeNone, "TAG_EMS_REQ_POWER_PV" },
+	{ TAG_EMS_REQ_POWER_BAT, RSCP::eTypeNone, "TAG_EMS_REQ_POWER_BAT" },
+	{ TAG_EMS_REQ_POWER_HOME, RSCP::eTypeNone, "TAG_EMS_REQ_POWER_HOME" },
+	{ TAG_EMS_REQ_POWER_GRID, RSCP::eTypeNone, "TAG_EMS_REQ_POWER_GRID" },
+	{ TAG_EMS_REQ_POWER_ADD, RSCP::eTypeNone, "TAG_EMS_REQ_POWER_ADD" },
+	{ TAG_EMS_REQ_AUTARKY, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_AUTARKY" },
+	{ TAG_EMS_REQ_SELF_CONSUMPTION, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SELF_CONSUMPTION" },
+	{ TAG_EMS_REQ_BAT_SOC, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_BAT_SOC" },
+	{ TAG_EMS_REQ_COUPLING_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_COUPLING_MODE" },
+	{ TAG_EMS_REQ_STORED_ERRORS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_STORED_ERRORS" },
+	{ TAG_EMS_REQ_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_MODE" },
+	{ TAG_EMS_REQ_BALANCED_PHASES, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_BALANCED_PHASES" },
+	{ TAG_EMS_REQ_INSTALLED_PEAK_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_INSTALLED_PEAK_POWER" },
+	{ TAG_EMS_REQ_DERATE_AT_PERCENT_VALUE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_DERATE_AT_PERCENT_VALUE" },
+	{ TAG_EMS_REQ_DERATE_AT_POWER_VALUE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_DERATE_AT_POWER_VALUE" },
+	{ TAG_EMS_REQ_ERROR_BUZZER_ENABLED, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_ERROR_BUZZER_ENABLED" },
+	{ TAG_EMS_REQ_SET_BALANCED_PHASES, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_BALANCED_PHASES" },
+	{ TAG_EMS_REQ_SET_INSTALLED_PEAK_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_INSTALLED_PEAK_POWER" },
+	{ TAG_EMS_REQ_SET_DERATE_PERCENT, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_DERATE_PERCENT" },
+	{ TAG_EMS_REQ_SET_ERROR_BUZZER_ENABLED, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_ERROR_BUZZER_ENABLED" },
+	{ TAG_EMS_REQ_START_ADJUST_BATTERY_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_START_ADJUST_BATTERY_VOLTAGE" },
+	{ TAG_EMS_REQ_CANCEL_ADJUST_BATTERY_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_CANCEL_ADJUST_BATTERY_VOLTAGE" },
+	{ TAG_EMS_REQ_ADJUST_BATTERY_VOLTAGE_STATUS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_ADJUST_BATTERY_VOLTAGE_STATUS" },
+	{ TAG_EMS_REQ_CONFIRM_ERRORS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_CONFIRM_ERRORS" },
+	{ TAG_EMS_REQ_POWER_WB_ALL, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_POWER_WB_ALL" },
+	{ TAG_EMS_REQ_POWER_WB_SOLAR, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_POWER_WB_SOLAR" },
+	{ TAG_EMS_REQ_EXT_SRC_AVAILABLE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_EXT_SRC_AVAILABLE" },
+	{ TAG_EMS_REQ_SET_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_POWER" },
+	{ TAG_EMS_REQ_SET_POWER_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_POWER_MODE" },
+	{ TAG_EMS_REQ_SET_POWER_VALUE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_POWER_VALUE" },
+	{ TAG_EMS_REQ_STATUS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_STATUS" },
+	{ TAG_EMS_REQ_USED_CHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_USED_CHARGE_LIMIT" },
+	{ TAG_EMS_REQ_BAT_CHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_BAT_CHARGE_LIMIT" },
+	{ TAG_EMS_REQ_DCDC_CHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_DCDC_CHARGE_LIMIT" },
+	{ TAG_EMS_REQ_USER_CHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_USER_CHARGE_LIMIT" },
+	{ TAG_EMS_REQ_USED_DISCHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_USED_DISCHARGE_LIMIT" },
+	{ TAG_EMS_REQ_BAT_DISCHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_BAT_DISCHARGE_LIMIT" },
+	{ TAG_EMS_REQ_DCDC_DISCHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_DCDC_DISCHARGE_LIMIT" },
+	{ TAG_EMS_REQ_USER_DISCHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_USER_DISCHARGE_LIMIT" },
+	{ TAG_EMS_REQ_SET_POWER_CONTROL_OFFSET, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_POWER_CONTROL_OFFSET" },
+	{ TAG_EMS_REQ_REMAINING_BAT_CHARGE_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_REMAINING_BAT_CHARGE_POWER" },
+	{ TAG_EMS_REQ_REMAINING_BAT_DISCHARGE_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_REMAINING_BAT_DISCHARGE_POWER" },
+	{ TAG_EMS_REQ_EMERGENCY_POWER_STATUS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_EMERGENCY_POWER_STATUS" },
+	{ TAG_EMS_REQ_SET_EMERGENCY_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_EMERGENCY_POWER" },
+	{ TAG_EMS_REQ_SET_OVERRIDE_AVAILABLE_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_OVERRIDE_AVAILABLE_POWER" },
+	{ TAG_EMS_REQ_SET_BATTERY_TO_CAR_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_BATTERY_TO_CAR_MODE" },
+	{ TAG_EMS_REQ_BATTERY_TO_CAR_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_BATTERY_TO_CAR_MODE" },
+	{ TAG_EMS_REQ_SET_BATTERY_BEFORE_CAR_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_BATTERY_BEFORE_CAR_MODE" },
+	{ TAG_EMS_REQ_BATTERY_BEFORE_CAR_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_BATTERY_BEFORE_CAR_MODE" },
+	{ TAG_EMS_REQ_GET_IDLE_PERIODS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_GET_IDLE_PERIODS" },
+	{ TAG_EMS_REQ_SET_IDLE_PERIODS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_IDLE_PERIODS" },
+	{ TAG_EMS_IDLE_PERIOD, RSCP_TYPE_UNKNOWN, "TAG_EMS_IDLE_PERIOD" },
+	{ TAG_EMS_IDLE_PERIOD_TYPE, RSCP_TYPE_UNKNOWN, "TAG_EMS_IDLE_PERIOD_TYPE" },
+	{ TAG_EMS_IDLE_PERIOD_DAY, RSCP_TYPE_UNKNOWN, "TAG_EMS_IDLE_PERIOD_DAY" },
+	{ TAG_EMS_IDLE_PERIOD_START, RSCP_TYPE_UNKNOWN, "TAG_EMS_IDLE_PERIOD_START" },
+	{ TAG_EMS_IDLE_PERIOD_END, RSCP_TYPE_UNKNOWN, "TAG_EMS_IDLE_PERIOD_END" },
+	{ TAG_EMS_IDLE_PERIOD_HOUR, RSCP_TYPE_UNKNOWN, "TAG_EMS_IDLE_PERIOD_HOUR" },
+	{ TAG_EMS_IDLE_PERIOD_MINUTE, RSCP_TYPE_UNKNOWN, "TAG_EMS_IDLE_PERIOD_MINUTE" },
+	{ TAG_EMS_IDLE_PERIOD_ACTIVE, RSCP_TYPE_UNKNOWN, "TAG_EMS_IDLE_PERIOD_ACTIVE" },
+	{ TAG_EMS_REQ_IDLE_PERIOD_CHANGE_MARKER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_IDLE_PERIOD_CHANGE_MARKER" },
+	{ TAG_EMS_REQ_GET_POWER_SETTINGS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_GET_POWER_SETTINGS" },
+	{ TAG_EMS_REQ_SET_POWER_SETTINGS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_POWER_SETTINGS" },
+	{ TAG_EMS_REQ_SETTINGS_CHANGE_MARKER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SETTINGS_CHANGE_MARKER" },
+	{ TAG_EMS_REQ_GET_MANUAL_CHARGE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_GET_MANUAL_CHARGE" },
+	{ TAG_EMS_REQ_START_MANUAL_CHARGE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_START_MANUAL_CHARGE" },
+	{ TAG_EMS_REQ_START_EMERGENCYPOWER_TEST, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_START_EMERGENCYPOWER_TEST" },
+	{ TAG_EMS_REQ_GET_GENERATOR_STATE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_GET_GENERATOR_STATE" },
+	{ TAG_EMS_REQ_SET_GENERATOR_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_SET_GENERATOR_MODE" },
+	{ TAG_EMS_REQ_EMERGENCYPOWER_TEST_STATUS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_EMERGENCYPOWER_TEST_STATUS" },
+	{ TAG_EMS_EPTEST_NEXT_TESTSTART, RSCP_TYPE_UNKNOWN, "TAG_EMS_EPTEST_NEXT_TESTSTART" },
+	{ TAG_EMS_EPTEST_START_COUNTER, RSCP_TYPE_UNKNOWN, "TAG_EMS_EPTEST_START_COUNTER" },
+	{ TAG_EMS_EPTEST_RUNNING, RSCP_TYPE_UNKNOWN, "TAG_EMS_EPTEST_RUNNING" },
+	{ TAG_EMS_REQ_GET_SYS_SPECS, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_GET_SYS_SPECS" },
+	{ TAG_EMS_SYS_SPEC, RSCP_TYPE_UNKNOWN, "TAG_EMS_SYS_SPEC" },
+	{ TAG_EMS_SYS_SPEC_INDEX, RSCP_TYPE_UNKNOWN, "TAG_EMS_SYS_SPEC_INDEX" },
+	{ TAG_EMS_SYS_SPEC_NAME, RSCP_TYPE_UNKNOWN, "TAG_EMS_SYS_SPEC_NAME" },
+	{ TAG_EMS_SYS_SPEC_VALUE_INT, RSCP_TYPE_UNKNOWN, "TAG_EMS_SYS_SPEC_VALUE_INT" },
+	{ TAG_EMS_SYS_SPEC_VALUE_STRING, RSCP_TYPE_UNKNOWN, "TAG_EMS_SYS_SPEC_VALUE_STRING" },
+	{ TAG_EMS_POWER_LIMITS_USED, RSCP_TYPE_UNKNOWN, "TAG_EMS_POWER_LIMITS_USED" },
+	{ TAG_EMS_MAX_CHARGE_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_MAX_CHARGE_POWER" },
+	{ TAG_EMS_MAX_DISCHARGE_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_MAX_DISCHARGE_POWER" },
+	{ TAG_EMS_DISCHARGE_START_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_DISCHARGE_START_POWER" },
+	{ TAG_EMS_POWERSAVE_ENABLED, RSCP_TYPE_UNKNOWN, "TAG_EMS_POWERSAVE_ENABLED" },
+	{ TAG_EMS_WEATHER_REGULATED_CHARGE_ENABLED, RSCP_TYPE_UNKNOWN, "TAG_EMS_WEATHER_REGULATED_CHARGE_ENABLED" },
+	{ TAG_EMS_MANUAL_CHARGE_START_COUNTER, RSCP_TYPE_UNKNOWN, "TAG_EMS_MANUAL_CHARGE_START_COUNTER" },
+	{ TAG_EMS_MANUAL_CHARGE_ACTIVE, RSCP_TYPE_UNKNOWN, "TAG_EMS_MANUAL_CHARGE_ACTIVE" },
+	{ TAG_EMS_MANUAL_CHARGE_ENERGY_COUNTER, RSCP_TYPE_UNKNOWN, "TAG_EMS_MANUAL_CHARGE_ENERGY_COUNTER" },
+	{ TAG_EMS_MANUAL_CHARGE_LASTSTART, RSCP_TYPE_UNKNOWN, "TAG_EMS_MANUAL_CHARGE_LASTSTART" },
+	{ TAG_EMS_REQ_ALIVE, RSCP_TYPE_UNKNOWN, "TAG_EMS_REQ_ALIVE" },
+	{ TAG_EMS_POWER_PV, RSCP::eTypeInt32, "TAG_EMS_POWER_PV" },
+	{ TAG_EMS_POWER_BAT, RSCP::eTypeInt32, "TAG_EMS_POWER_BAT" },
+	{ TAG_EMS_POWER_HOME, RSCP::eTypeInt32, "TAG_EMS_POWER_HOME" },
+	{ TAG_EMS_POWER_GRID, RSCP::eTypeInt32, "TAG_EMS_POWER_GRID" },
+	{ TAG_EMS_POWER_ADD, RSCP::eTypeInt32, "TAG_EMS_POWER_ADD" },
+	{ TAG_EMS_AUTARKY, RSCP_TYPE_UNKNOWN, "TAG_EMS_AUTARKY" },
+	{ TAG_EMS_SELF_CONSUMPTION, RSCP_TYPE_UNKNOWN, "TAG_EMS_SELF_CONSUMPTION" },
+	{ TAG_EMS_BAT_SOC, RSCP_TYPE_UNKNOWN, "TAG_EMS_BAT_SOC" },
+	{ TAG_EMS_COUPLING_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_COUPLING_MODE" },
+	{ TAG_EMS_STORED_ERRORS, RSCP_TYPE_UNKNOWN, "TAG_EMS_STORED_ERRORS" },
+	{ TAG_EMS_ERROR_CONTAINER, RSCP_TYPE_UNKNOWN, "TAG_EMS_ERROR_CONTAINER" },
+	{ TAG_EMS_ERROR_TYPE, RSCP_TYPE_UNKNOWN, "TAG_EMS_ERROR_TYPE" },
+	{ TAG_EMS_ERROR_SOURCE, RSCP_TYPE_UNKNOWN, "TAG_EMS_ERROR_SOURCE" },
+	{ TAG_EMS_ERROR_MESSAGE, RSCP_TYPE_UNKNOWN, "TAG_EMS_ERROR_MESSAGE" },
+	{ TAG_EMS_ERROR_CODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_ERROR_CODE" },
+	{ TAG_EMS_ERROR_TIMESTAMP, RSCP_TYPE_UNKNOWN, "TAG_EMS_ERROR_TIMESTAMP" },
+	{ TAG_EMS_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_MODE" },
+	{ TAG_EMS_BALANCED_PHASES, RSCP_TYPE_UNKNOWN, "TAG_EMS_BALANCED_PHASES" },
+	{ TAG_EMS_INSTALLED_PEAK_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_INSTALLED_PEAK_POWER" },
+	{ TAG_EMS_DERATE_AT_PERCENT_VALUE, RSCP_TYPE_UNKNOWN, "TAG_EMS_DERATE_AT_PERCENT_VALUE" },
+	{ TAG_EMS_DERATE_AT_POWER_VALUE, RSCP_TYPE_UNKNOWN, "TAG_EMS_DERATE_AT_POWER_VALUE" },
+	{ TAG_EMS_ERROR_BUZZER_ENABLED, RSCP_TYPE_UNKNOWN, "TAG_EMS_ERROR_BUZZER_ENABLED" },
+	{ TAG_EMS_SET_BALANCED_PHASES, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_BALANCED_PHASES" },
+	{ TAG_EMS_SET_INSTALLED_PEAK_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_INSTALLED_PEAK_POWER" },
+	{ TAG_EMS_SET_DERATE_PERCENT, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_DERATE_PERCENT" },
+	{ TAG_EMS_SET_ERROR_BUZZER_ENABLED, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_ERROR_BUZZER_ENABLED" },
+	{ TAG_EMS_START_ADJUST_BATTERY_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_EMS_START_ADJUST_BATTERY_VOLTAGE" },
+	{ TAG_EMS_CANCEL_ADJUST_BATTERY_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_EMS_CANCEL_ADJUST_BATTERY_VOLTAGE" },
+	{ TAG_EMS_ADJUST_BATTERY_VOLTAGE_STATUS, RSCP_TYPE_UNKNOWN, "TAG_EMS_ADJUST_BATTERY_VOLTAGE_STATUS" },
+	{ TAG_EMS_CONFIRM_ERRORS, RSCP_TYPE_UNKNOWN, "TAG_EMS_CONFIRM_ERRORS" },
+	{ TAG_EMS_POWER_WB_ALL, RSCP_TYPE_UNKNOWN, "TAG_EMS_POWER_WB_ALL" },
+	{ TAG_EMS_POWER_WB_SOLAR, RSCP_TYPE_UNKNOWN, "TAG_EMS_POWER_WB_SOLAR" },
+	{ TAG_EMS_EXT_SRC_AVAILABLE, RSCP_TYPE_UNKNOWN, "TAG_EMS_EXT_SRC_AVAILABLE" },
+	{ TAG_EMS_SET_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_POWER" },
+	{ TAG_EMS_STATUS, RSCP_TYPE_UNKNOWN, "TAG_EMS_STATUS" },
+	{ TAG_EMS_USED_CHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_USED_CHARGE_LIMIT" },
+	{ TAG_EMS_BAT_CHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_BAT_CHARGE_LIMIT" },
+	{ TAG_EMS_DCDC_CHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_DCDC_CHARGE_LIMIT" },
+	{ TAG_EMS_USER_CHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_USER_CHARGE_LIMIT" },
+	{ TAG_EMS_USED_DISCHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_USED_DISCHARGE_LIMIT" },
+	{ TAG_EMS_BAT_DISCHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_BAT_DISCHARGE_LIMIT" },
+	{ TAG_EMS_DCDC_DISCHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_DCDC_DISCHARGE_LIMIT" },
+	{ TAG_EMS_USER_DISCHARGE_LIMIT, RSCP_TYPE_UNKNOWN, "TAG_EMS_USER_DISCHARGE_LIMIT" },
+	{ TAG_EMS_SET_POWER_CONTROL_OFFSET, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_POWER_CONTROL_OFFSET" },
+	{ TAG_EMS_REMAINING_BAT_CHARGE_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REMAINING_BAT_CHARGE_POWER" },
+	{ TAG_EMS_REMAINING_BAT_DISCHARGE_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_REMAINING_BAT_DISCHARGE_POWER" },
+	{ TAG_EMS_EMERGENCY_POWER_STATUS, RSCP_TYPE_UNKNOWN, "TAG_EMS_EMERGENCY_POWER_STATUS" },
+	{ TAG_EMS_SET_EMERGENCY_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_EMERGENCY_POWER" },
+	{ TAG_EMS_SET_OVERRIDE_AVAILABLE_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_OVERRIDE_AVAILABLE_POWER" },
+	{ TAG_EMS_SET_BATTERY_TO_CAR_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_BATTERY_TO_CAR_MODE" },
+	{ TAG_EMS_BATTERY_TO_CAR_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_BATTERY_TO_CAR_MODE" },
+	{ TAG_EMS_SET_BATTERY_BEFORE_CAR_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_BATTERY_BEFORE_CAR_MODE" },
+	{ TAG_EMS_BATTERY_BEFORE_CAR_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_BATTERY_BEFORE_CAR_MODE" },
+	{ TAG_EMS_GET_IDLE_PERIODS, RSCP_TYPE_UNKNOWN, "TAG_EMS_GET_IDLE_PERIODS" },
+	{ TAG_EMS_SET_IDLE_PERIODS, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_IDLE_PERIODS" },
+	{ TAG_EMS_IDLE_PERIOD_CHANGE_MARKER, RSCP_TYPE_UNKNOWN, "TAG_EMS_IDLE_PERIOD_CHANGE_MARKER" },
+	{ TAG_EMS_GET_POWER_SETTINGS, RSCP_TYPE_UNKNOWN, "TAG_EMS_GET_POWER_SETTINGS" },
+	{ TAG_EMS_SET_POWER_SETTINGS, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_POWER_SETTINGS" },
+	{ TAG_EMS_SETTINGS_CHANGE_MARKER, RSCP_TYPE_UNKNOWN, "TAG_EMS_SETTINGS_CHANGE_MARKER" },
+	{ TAG_EMS_GET_MANUAL_CHARGE, RSCP_TYPE_UNKNOWN, "TAG_EMS_GET_MANUAL_CHARGE" },
+	{ TAG_EMS_START_MANUAL_CHARGE, RSCP_TYPE_UNKNOWN, "TAG_EMS_START_MANUAL_CHARGE" },
+	{ TAG_EMS_START_EMERGENCYPOWER_TEST, RSCP_TYPE_UNKNOWN, "TAG_EMS_START_EMERGENCYPOWER_TEST" },
+	{ TAG_EMS_GET_GENERATOR_STATE, RSCP_TYPE_UNKNOWN, "TAG_EMS_GET_GENERATOR_STATE" },
+	{ TAG_EMS_SET_GENERATOR_MODE, RSCP_TYPE_UNKNOWN, "TAG_EMS_SET_GENERATOR_MODE" },
+	{ TAG_EMS_EMERGENCYPOWER_TEST_STATUS, RSCP_TYPE_UNKNOWN, "TAG_EMS_EMERGENCYPOWER_TEST_STATUS" },
+	{ TAG_EMS_GET_SYS_SPECS, RSCP_TYPE_UNKNOWN, "TAG_EMS_GET_SYS_SPECS" },
+	{ TAG_EMS_RES_POWER_LIMITS_USED, RSCP_TYPE_UNKNOWN, "TAG_EMS_RES_POWER_LIMITS_USED" },
+	{ TAG_EMS_RES_MAX_CHARGE_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_RES_MAX_CHARGE_POWER" },
+	{ TAG_EMS_RES_MAX_DISCHARGE_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_RES_MAX_DISCHARGE_POWER" },
+	{ TAG_EMS_RES_DISCHARGE_START_POWER, RSCP_TYPE_UNKNOWN, "TAG_EMS_RES_DISCHARGE_START_POWER" },
+	{ TAG_EMS_RES_POWERSAVE_ENABLED, RSCP_TYPE_UNKNOWN, "TAG_EMS_RES_POWERSAVE_ENABLED" },
+	{ TAG_EMS_RES_WEATHER_REGULATED_CHARGE_ENABLED, RSCP_TYPE_UNKNOWN, "TAG_EMS_RES_WEATHER_REGULATED_CHARGE_ENABLED" },
+	{ TAG_EMS_ALIVE, RSCP_TYPE_UNKNOWN, "TAG_EMS_ALIVE" },
+	{ TAG_EMS_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_EMS_GENERAL_ERROR" },
+	{ TAG_PVI_REQ_ON_GRID, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_ON_GRID" },
+	{ TAG_PVI_REQ_STATE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_STATE" },
+	{ TAG_PVI_REQ_LAST_ERROR, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_LAST_ERROR" },
+	{ TAG_PVI_REQ_TYPE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_TYPE" },
+	{ TAG_PVI_REQ_COS_PHI, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_COS_PHI" },
+	{ TAG_PVI_REQ_SET_COS_PHI, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_SET_COS_PHI" },
+	{ TAG_PVI_COS_PHI_VALUE, RSCP_TYPE_UNKNOWN, "TAG_PVI_COS_PHI_VALUE" },
+	{ TAG_PVI_COS_PHI_IS_AKTIV, RSCP_TYPE_UNKNOWN, "TAG_PVI_COS_PHI_IS_AKTIV" },
+	{ TAG_PVI_COS_PHI_EXCITED, RSCP_TYPE_UNKNOWN, "TAG_PVI_COS_PHI_EXCITED" },
+	{ TAG_PVI_REQ_VOLTAGE_MONITORING, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_VOLTAGE_MONITORING" },
+	{ TAG_PVI_VOLTAGE_MONITORING_THRESHOLD_TOP, RSCP_TYPE_UNKNOWN, "TAG_PVI_VOLTAGE_MONITORING_THRESHOLD_TOP" },
+	{ TAG_PVI_VOLTAGE_MONITORING_THRESHOLD_BOTTOM, RSCP_TYPE_UNKNOWN, "TAG_PVI_VOLTAGE_MONITORING_THRESHOLD_BOTTOM" },
+	{ TAG_PVI_VOLTAGE_MONITORING_SLOPE_UP, RSCP_TYPE_UNKNOWN, "TAG_PVI_VOLTAGE_MONITORING_SLOPE_UP" },
+	{ TAG_PVI_VOLTAGE_MONITORING_SLOPE_DOWN, RSCP_TYPE_UNKNOWN, "TAG_PVI_VOLTAGE_MONITORING_SLOPE_DOWN" },
+	{ TAG_PVI_REQ_FREQUENCY_UNDER_OVER, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_FREQUENCY_UNDER_OVER" },
+	{ TAG_PVI_FREQUENCY_UNDER, RSCP_TYPE_UNKNOWN, "TAG_PVI_FREQUENCY_UNDER" },
+	{ TAG_PVI_FREQUENCY_OVER, RSCP_TYPE_UNKNOWN, "TAG_PVI_FREQUENCY_OVER" },
+	{ TAG_PVI_REQ_SYSTEM_MODE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_SYSTEM_MODE" },
+	{ TAG_PVI_REQ_POWER_MODE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_POWER_MODE" },
+	{ TAG_PVI_REQ_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_TEMPERATURE" },
+	{ TAG_PVI_REQ_TEMPERATURE_COUNT, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_TEMPERATURE_COUNT" },
+	{ TAG_PVI_REQ_MAX_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_MAX_TEMPERATURE" },
+	{ TAG_PVI_REQ_MIN_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_MIN_TEMPERATURE" },
+	{ TAG_PVI_REQ_DATA, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DATA" },
+	{ TAG_PVI_INDEX, RSCP_TYPE_UNKNOWN, "TAG_PVI_INDEX" },
+	{ TAG_PVI_VALUE, RSCP_TYPE_UNKNOWN, "TAG_PVI_VALUE" },
+	{ TAG_PVI_REQ_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DEVICE_STATE" },
+	{ TAG_PVI_REQ_SERIAL_NUMBER, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_SERIAL_NUMBER" },
+	{ TAG_PVI_REQ_VERSION, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_VERSION" },
+	{ TAG_PVI_VERSION_MAIN, RSCP_TYPE_UNKNOWN, "TAG_PVI_VERSION_MAIN" },
+	{ TAG_PVI_VERSION_PIC, RSCP_TYPE_UNKNOWN, "TAG_PVI_VERSION_PIC" },
+	{ TAG_PVI_REQ_AC_MAX_PHASE_COUNT, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_AC_MAX_PHASE_COUNT" },
+	{ TAG_PVI_REQ_AC_POWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_AC_POWER" },
+	{ TAG_PVI_REQ_AC_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_AC_VOLTAGE" },
+	{ TAG_PVI_REQ_AC_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_AC_CURRENT" },
+	{ TAG_PVI_REQ_AC_APPARENTPOWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_AC_APPARENTPOWER" },
+	{ TAG_PVI_REQ_AC_REACTIVEPOWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_AC_REACTIVEPOWER" },
+	{ TAG_PVI_REQ_AC_ENERGY_ALL, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_AC_ENERGY_ALL" },
+	{ TAG_PVI_REQ_AC_MAX_APPARENTPOWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_AC_MAX_APPARENTPOWER" },
+	{ TAG_PVI_REQ_AC_ENERGY_DAY, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_AC_ENERGY_DAY" },
+	{ TAG_PVI_REQ_AC_ENERGY_GRID_CONSUMPTION, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_AC_ENERGY_GRID_CONSUMPTION" },
+	{ TAG_PVI_REQ_DC_MAX_STRING_COUNT, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DC_MAX_STRING_COUNT" },
+	{ TAG_PVI_REQ_DC_POWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DC_POWER" },
+	{ TAG_PVI_REQ_DC_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DC_VOLTAGE" },
+	{ TAG_PVI_REQ_DC_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DC_CURRENT" },
+	{ TAG_PVI_REQ_DC_MAX_POWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DC_MAX_POWER" },
+	{ TAG_PVI_REQ_DC_MAX_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DC_MAX_VOLTAGE" },
+	{ TAG_PVI_REQ_DC_MIN_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DC_MIN_VOLTAGE" },
+	{ TAG_PVI_REQ_DC_MAX_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DC_MAX_CURRENT" },
+	{ TAG_PVI_REQ_DC_MIN_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DC_MIN_CURRENT" },
+	{ TAG_PVI_REQ_DC_STRING_ENERGY_ALL, RSCP_TYPE_UNKNOWN, "TAG_PVI_REQ_DC_STRING_ENERGY_ALL" },
+	{ TAG_PVI_ON_GRID, RSCP_TYPE_UNKNOWN, "TAG_PVI_ON_GRID" },
+	{ TAG_PVI_STATE, RSCP_TYPE_UNKNOWN, "TAG_PVI_STATE" },
+	{ TAG_PVI_LAST_ERROR, RSCP_TYPE_UNKNOWN, "TAG_PVI_LAST_ERROR" },
+	{ TAG_PVI_FLASH_FILE, RSCP_TYPE_UNKNOWN, "TAG_PVI_FLASH_FILE" },
+	{ TAG_PVI_TYPE, RSCP_TYPE_UNKNOWN, "TAG_PVI_TYPE" },
+	{ TAG_PVI_COS_PHI, RSCP_TYPE_UNKNOWN, "TAG_PVI_COS_PHI" },
+	{ TAG_PVI_VOLTAGE_MONITORING, RSCP_TYPE_UNKNOWN, "TAG_PVI_VOLTAGE_MONITORING" },
+	{ TAG_PVI_FREQUENCY_UNDER_OVER, RSCP_TYPE_UNKNOWN, "TAG_PVI_FREQUENCY_UNDER_OVER" },
+	{ TAG_PVI_SYSTEM_MODE, RSCP_TYPE_UNKNOWN, "TAG_PVI_SYSTEM_MODE" },
+	{ TAG_PVI_POWER_MODE, RSCP_TYPE_UNKNOWN, "TAG_PVI_POWER_MODE" },
+	{ TAG_PVI_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_PVI_TEMPERATURE" },
+	{ TAG_PVI_TEMPERATURE_COUNT, RSCP_TYPE_UNKNOWN, "TAG_PVI_TEMPERATURE_COUNT" },
+	{ TAG_PVI_MAX_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_PVI_MAX_TEMPERATURE" },
+	{ TAG_PVI_MIN_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_PVI_MIN_TEMPERATURE" },
+	{ TAG_PVI_DATA, RSCP_TYPE_UNKNOWN, "TAG_PVI_DATA" },
+	{ TAG_PVI_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_PVI_DEVICE_STATE" },
+	{ TAG_PVI_DEVICE_CONNECTED, RSCP_TYPE_UNKNOWN, "TAG_PVI_DEVICE_CONNECTED" },
+	{ TAG_PVI_DEVICE_WORKING, RSCP_TYPE_UNKNOWN, "TAG_PVI_DEVICE_WORKING" },
+	{ TAG_PVI_DEVICE_IN_SERVICE, RSCP_TYPE_UNKNOWN, "TAG_PVI_DEVICE_IN_SERVICE" },
+	{ TAG_PVI_SERIAL_NUMBER, RSCP_TYPE_UNKNOWN, "TAG_PVI_SERIAL_NUMBER" },
+	{ TAG_PVI_VERSION, RSCP_TYPE_UNKNOWN, "TAG_PVI_VERSION" },
+	{ TAG_PVI_AC_MAX_PHASE_COUNT, RSCP_TYPE_UNKNOWN, "TAG_PVI_AC_MAX_PHASE_COUNT" },
+	{ TAG_PVI_AC_POWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_AC_POWER" },
+	{ TAG_PVI_AC_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_PVI_AC_VOLTAGE" },
+	{ TAG_PVI_AC_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_PVI_AC_CURRENT" },
+	{ TAG_PVI_AC_APPARENTPOWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_AC_APPARENTPOWER" },
+	{ TAG_PVI_AC_REACTIVEPOWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_AC_REACTIVEPOWER" },
+	{ TAG_PVI_AC_ENERGY_ALL, RSCP_TYPE_UNKNOWN, "TAG_PVI_AC_ENERGY_ALL" },
+	{ TAG_PVI_AC_MAX_APPARENTPOWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_AC_MAX_APPARENTPOWER" },
+	{ TAG_PVI_AC_ENERGY_DAY, RSCP_TYPE_UNKNOWN, "TAG_PVI_AC_ENERGY_DAY" },
+	{ TAG_PVI_AC_ENERGY_GRID_CONSUMPTION, RSCP_TYPE_UNKNOWN, "TAG_PVI_AC_ENERGY_GRID_CONSUMPTION" },
+	{ TAG_PVI_DC_MAX_STRING_COUNT, RSCP_TYPE_UNKNOWN, "TAG_PVI_DC_MAX_STRING_COUNT" },
+	{ TAG_PVI_DC_POWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_DC_POWER" },
+	{ TAG_PVI_DC_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_PVI_DC_VOLTAGE" },
+	{ TAG_PVI_DC_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_PVI_DC_CURRENT" },
+	{ TAG_PVI_DC_MAX_POWER, RSCP_TYPE_UNKNOWN, "TAG_PVI_DC_MAX_POWER" },
+	{ TAG_PVI_DC_MAX_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_PVI_DC_MAX_VOLTAGE" },
+	{ TAG_PVI_DC_MIN_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_PVI_DC_MIN_VOLTAGE" },
+	{ TAG_PVI_DC_MAX_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_PVI_DC_MAX_CURRENT" },
+	{ TAG_PVI_DC_MIN_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_PVI_DC_MIN_CURRENT" },
+	{ TAG_PVI_DC_STRING_ENERGY_ALL, RSCP_TYPE_UNKNOWN, "TAG_PVI_DC_STRING_ENERGY_ALL" },
+	{ TAG_PVI_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_PVI_GENERAL_ERROR" },
+	{ TAG_BAT_REQ_RSOC, RSCP::eTypeNone, "TAG_BAT_REQ_RSOC" },
+	{ TAG_BAT_REQ_MODULE_VOLTAGE, RSCP::eTypeNone, "TAG_BAT_REQ_MODULE_VOLTAGE" },
+	{ TAG_BAT_REQ_CURRENT, RSCP::eTypeNone, "TAG_BAT_REQ_CURRENT" },
+	{ TAG_BAT_REQ_MAX_BAT_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_MAX_BAT_VOLTAGE" },
+	{ TAG_BAT_REQ_MAX_CHARGE_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_MAX_CHARGE_CURRENT" },
+	{ TAG_BAT_REQ_EOD_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_EOD_VOLTAGE" },
+	{ TAG_BAT_REQ_MAX_DISCHARGE_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_MAX_DISCHARGE_CURRENT" },
+	{ TAG_BAT_REQ_CHARGE_CYCLES, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_CHARGE_CYCLES" },
+	{ TAG_BAT_REQ_TERMINAL_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_TERMINAL_VOLTAGE" },
+	{ TAG_BAT_REQ_STATUS_CODE, RSCP::eTypeNone, "TAG_BAT_REQ_STATUS_CODE" },
+	{ TAG_BAT_REQ_ERROR_CODE, RSCP::eTypeNone, "TAG_BAT_REQ_ERROR_CODE" },
+	{ TAG_BAT_REQ_DEVICE_NAME, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_DEVICE_NAME" },
+	{ TAG_BAT_REQ_DCB_COUNT, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_DCB_COUNT" },
+	{ TAG_BAT_REQ_MAX_DCB_CELL_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_MAX_DCB_CELL_TEMPERATURE" },
+	{ TAG_BAT_REQ_MIN_DCB_CELL_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_MIN_DCB_CELL_TEMPERATURE" },
+	{ TAG_BAT_REQ_READY_FOR_SHUTDOWN, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_READY_FOR_SHUTDOWN" },
+	{ TAG_BAT_REQ_INFO, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_INFO" },
+	{ TAG_BAT_REQ_TRAINING_MODE, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_TRAINING_MODE" },
+	{ TAG_BAT_REQ_DATA, RSCP::eTypeContainer, "TAG_BAT_REQ_DATA" },
+	{ TAG_BAT_INDEX, RSCP::eTypeUChar8, "TAG_BAT_INDEX" },
+	{ TAG_BAT_REQ_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_BAT_REQ_DEVICE_STATE" },
+	{ TAG_BAT_RSOC, RSCP::eTypeFloat32, "TAG_BAT_RSOC" },
+	{ TAG_BAT_MODULE_VOLTAGE, RSCP::eTypeFloat32, "TAG_BAT_MODULE_VOLTAGE" },
+	{ TAG_BAT_CURRENT, RSCP::eTypeFloat32, "TAG_BAT_CURRENT" },
+	{ TAG_BAT_MAX_BAT_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_MAX_BAT_VOLTAGE" },
+	{ TAG_BAT_MAX_CHARGE_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_BAT_MAX_CHARGE_CURRENT" },
+	{ TAG_BAT_EOD_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_EOD_VOLTAGE" },
+	{ TAG_BAT_MAX_DISCHARGE_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_BAT_MAX_DISCHARGE_CURRENT" },
+	{ TAG_BAT_CHARGE_CYCLES, RSCP_TYPE_UNKNOWN, "TAG_BAT_CHARGE_CYCLES" },
+	{ TAG_BAT_TERMINAL_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_TERMINAL_VOLTAGE" },
+	{ TAG_BAT_STATUS_CODE, RSCP::eTypeUInt32, "TAG_BAT_STATUS_CODE" },
+	{ TAG_BAT_ERROR_CODE, RSCP::eTypeUInt32, "TAG_BAT_ERROR_CODE" },
+	{ TAG_BAT_DEVICE_NAME, RSCP_TYPE_UNKNOWN, "TAG_BAT_DEVICE_NAME" },
+	{ TAG_BAT_DCB_COUNT, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_COUNT" },
+	{ TAG_BAT_MAX_DCB_CELL_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_BAT_MAX_DCB_CELL_TEMPERATURE" },
+	{ TAG_BAT_MIN_DCB_CELL_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_BAT_MIN_DCB_CELL_TEMPERATURE" },
+	{ TAG_BAT_DCB_CELL_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_CELL_TEMPERATURE" },
+	{ TAG_BAT_DCB_CELL_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_CELL_VOLTAGE" },
+	{ TAG_BAT_READY_FOR_SHUTDOWN, RSCP_TYPE_UNKNOWN, "TAG_BAT_READY_FOR_SHUTDOWN" },
+	{ TAG_BAT_INFO, RSCP_TYPE_UNKNOWN, "TAG_BAT_INFO" },
+	{ TAG_BAT_TRAINING_MODE, RSCP_TYPE_UNKNOWN, "TAG_BAT_TRAINING_MODE" },
+	{ TAG_BAT_DCB_INDEX, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_INDEX" },
+	{ TAG_BAT_DCB_LAST_MESSAGE_TIMESTAMP, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_LAST_MESSAGE_TIMESTAMP" },
+	{ TAG_BAT_DCB_MAX_CHARGE_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_MAX_CHARGE_VOLTAGE" },
+	{ TAG_BAT_DCB_MAX_CHARGE_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_MAX_CHARGE_CURRENT" },
+	{ TAG_BAT_DCB_END_OF_DISCHARGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_END_OF_DISCHARGE" },
+	{ TAG_BAT_DCB_MAX_DISCHARGE_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_MAX_DISCHARGE_CURRENT" },
+	{ TAG_BAT_DCB_FULL_CHARGE_CAPACITY, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_FULL_CHARGE_CAPACITY" },
+	{ TAG_BAT_DCB_REMAINING_CAPACITY, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_REMAINING_CAPACITY" },
+	{ TAG_BAT_DCB_SOC, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_SOC" },
+	{ TAG_BAT_DCB_SOH, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_SOH" },
+	{ TAG_BAT_DCB_CYCLE_COUNT, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_CYCLE_COUNT" },
+	{ TAG_BAT_DCB_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_CURRENT" },
+	{ TAG_BAT_DCB_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_VOLTAGE" },
+	{ TAG_BAT_DCB_CURRENT_AVG_30S, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_CURRENT_AVG_30S" },
+	{ TAG_BAT_DCB_VOLTAGE_AVG_30S, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_VOLTAGE_AVG_30S" },
+	{ TAG_BAT_DCB_DESIGN_CAPACITY, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_DESIGN_CAPACITY" },
+	{ TAG_BAT_DCB_DESIGN_VOLTAGE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_DESIGN_VOLTAGE" },
+	{ TAG_BAT_DCB_CHARGE_LOW_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_CHARGE_LOW_TEMPERATURE" },
+	{ TAG_BAT_DCB_CHARGE_HIGH_TEMPERATURE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_CHARGE_HIGH_TEMPERATURE" },
+	{ TAG_BAT_DCB_MANUFACTURE_DATE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_MANUFACTURE_DATE" },
+	{ TAG_BAT_DCB_SERIALNO, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_SERIALNO" },
+	{ TAG_BAT_DCB_PROTOCOL_VERSION, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_PROTOCOL_VERSION" },
+	{ TAG_BAT_DCB_FW_VERSION, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_FW_VERSION" },
+	{ TAG_BAT_DCB_DATA_TABLE_VERSION, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_DATA_TABLE_VERSION" },
+	{ TAG_BAT_DCB_PCB_VERSION, RSCP_TYPE_UNKNOWN, "TAG_BAT_DCB_PCB_VERSION" },
+	{ TAG_BAT_DATA, RSCP::eTypeContainer, "TAG_BAT_DATA" },
+	{ TAG_BAT_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DEVICE_STATE" },
+	{ TAG_BAT_DEVICE_CONNECTED, RSCP_TYPE_UNKNOWN, "TAG_BAT_DEVICE_CONNECTED" },
+	{ TAG_BAT_DEVICE_WORKING, RSCP_TYPE_UNKNOWN, "TAG_BAT_DEVICE_WORKING" },
+	{ TAG_BAT_DEVICE_IN_SERVICE, RSCP_TYPE_UNKNOWN, "TAG_BAT_DEVICE_IN_SERVICE" },
+	{ TAG_BAT_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_BAT_GENERAL_ERROR" },
+	{ TAG_DCDC_REQ_I_BAT, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_I_BAT" },
+	{ TAG_DCDC_REQ_U_BAT, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_U_BAT" },
+	{ TAG_DCDC_REQ_P_BAT, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_P_BAT" },
+	{ TAG_DCDC_REQ_I_DCL, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_I_DCL" },
+	{ TAG_DCDC_REQ_U_DCL, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_U_DCL" },
+	{ TAG_DCDC_REQ_P_DCL, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_P_DCL" },
+	{ TAG_DCDC_REQ_FIRMWARE_VERSION, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_FIRMWARE_VERSION" },
+	{ TAG_DCDC_REQ_FPGA_FIRMWARE, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_FPGA_FIRMWARE" },
+	{ TAG_DCDC_REQ_SERIAL_NUMBER, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_SERIAL_NUMBER" },
+	{ TAG_DCDC_REQ_BOARD_VERSION, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_BOARD_VERSION" },
+	{ TAG_DCDC_REQ_FLASH_FILE_LIST, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_FLASH_FILE_LIST" },
+	{ TAG_DCDC_REQ_IS_FLASHING, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_IS_FLASHING" },
+	{ TAG_DCDC_REQ_FLASH, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_FLASH" },
+	{ TAG_DCDC_REQ_STATUS, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_STATUS" },
+	{ TAG_DCDC_REQ_STATUS_AS_STRING, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_STATUS_AS_STRING" },
+	{ TAG_DCDC_REQ_DATA, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_DATA" },
+	{ TAG_DCDC_INDEX, RSCP_TYPE_UNKNOWN, "TAG_DCDC_INDEX" },
+	{ TAG_DCDC_REQ_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_DCDC_REQ_DEVICE_STATE" },
+	{ TAG_DCDC_I_BAT, RSCP_TYPE_UNKNOWN, "TAG_DCDC_I_BAT" },
+	{ TAG_DCDC_U_BAT, RSCP_TYPE_UNKNOWN, "TAG_DCDC_U_BAT" },
+	{ TAG_DCDC_P_BAT, RSCP_TYPE_UNKNOWN, "TAG_DCDC_P_BAT" },
+	{ TAG_DCDC_I_DCL, RSCP_TYPE_UNKNOWN, "TAG_DCDC_I_DCL" },
+	{ TAG_DCDC_U_DCL, RSCP_TYPE_UNKNOWN, "TAG_DCDC_U_DCL" },
+	{ TAG_DCDC_P_DCL, RSCP_TYPE_UNKNOWN, "TAG_DCDC_P_DCL" },
+	{ TAG_DCDC_FIRMWARE_VERSION, RSCP_TYPE_UNKNOWN, "TAG_DCDC_FIRMWARE_VERSION" },
+	{ TAG_DCDC_FPGA_FIRMWARE, RSCP_TYPE_UNKNOWN, "TAG_DCDC_FPGA_FIRMWARE" },
+	{ TAG_DCDC_SERIAL_NUMBER, RSCP_TYPE_UNKNOWN, "TAG_DCDC_SERIAL_NUMBER" },
+	{ TAG_DCDC_BOARD_VERSION, RSCP_TYPE_UNKNOWN, "TAG_DCDC_BOARD_VERSION" },
+	{ TAG_DCDC_FLASH_FILE_LIST, RSCP_TYPE_UNKNOWN, "TAG_DCDC_FLASH_FILE_LIST" },
+	{ TAG_DCDC_FLASH_FILE, RSCP_TYPE_UNKNOWN, "TAG_DCDC_FLASH_FILE" },
+	{ TAG_DCDC_IS_FLASHING, RSCP_TYPE_UNKNOWN, "TAG_DCDC_IS_FLASHING" },
+	{ TAG_DCDC_FLASH, RSCP_TYPE_UNKNOWN, "TAG_DCDC_FLASH" },
+	{ TAG_DCDC_STATUS, RSCP_TYPE_UNKNOWN, "TAG_DCDC_STATUS" },
+	{ TAG_DCDC_STATE, RSCP_TYPE_UNKNOWN, "TAG_DCDC_STATE" },
+	{ TAG_DCDC_SUBSTATE, RSCP_TYPE_UNKNOWN, "TAG_DCDC_SUBSTATE" },
+	{ TAG_DCDC_STATUS_AS_STRING, RSCP_TYPE_UNKNOWN, "TAG_DCDC_STATUS_AS_STRING" },
+	{ TAG_DCDC_STATE_AS_STRING, RSCP_TYPE_UNKNOWN, "TAG_DCDC_STATE_AS_STRING" },
+	{ TAG_DCDC_SUBSTATE_AS_STRING, RSCP_TYPE_UNKNOWN, "TAG_DCDC_SUBSTATE_AS_STRING" },
+	{ TAG_DCDC_DATA, RSCP_TYPE_UNKNOWN, "TAG_DCDC_DATA" },
+	{ TAG_DCDC_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_DCDC_DEVICE_STATE" },
+	{ TAG_DCDC_DEVICE_CONNECTED, RSCP_TYPE_UNKNOWN, "TAG_DCDC_DEVICE_CONNECTED" },
+	{ TAG_DCDC_DEVICE_WORKING, RSCP_TYPE_UNKNOWN, "TAG_DCDC_DEVICE_WORKING" },
+	{ TAG_DCDC_DEVICE_IN_SERVICE, RSCP_TYPE_UNKNOWN, "TAG_DCDC_DEVICE_IN_SERVICE" },
+	{ TAG_DCDC_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_DCDC_GENERAL_ERROR" },
+	{ TAG_PM_REQ_POWER_L1, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_POWER_L1" },
+	{ TAG_PM_REQ_POWER_L2, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_POWER_L2" },
+	{ TAG_PM_REQ_POWER_L3, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_POWER_L3" },
+	{ TAG_PM_REQ_ACTIVE_PHASES, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_ACTIVE_PHASES" },
+	{ TAG_PM_REQ_MODE, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_MODE" },
+	{ TAG_PM_REQ_ENERGY_L1, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_ENERGY_L1" },
+	{ TAG_PM_REQ_ENERGY_L2, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_ENERGY_L2" },
+	{ TAG_PM_REQ_ENERGY_L3, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_ENERGY_L3" },
+	{ TAG_PM_REQ_DEVICE_ID, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_DEVICE_ID" },
+	{ TAG_PM_REQ_ERROR_CODE, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_ERROR_CODE" },
+	{ TAG_PM_REQ_SET_PHASE_ELIMINATION, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_SET_PHASE_ELIMINATION" },
+	{ TAG_PM_REQ_FIRMWARE_VERSION, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_FIRMWARE_VERSION" },
+	{ TAG_PM_REQ_VOLTAGE_L1, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_VOLTAGE_L1" },
+	{ TAG_PM_REQ_VOLTAGE_L2, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_VOLTAGE_L2" },
+	{ TAG_PM_REQ_VOLTAGE_L3, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_VOLTAGE_L3" },
+	{ TAG_PM_REQ_TYPE, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_TYPE" },
+	{ TAG_PM_REQ_GET_PHASE_ELIMINATION, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_GET_PHASE_ELIMINATION" },
+	{ TAG_PM_REQ_DATA, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_DATA" },
+	{ TAG_PM_INDEX, RSCP_TYPE_UNKNOWN, "TAG_PM_INDEX" },
+	{ TAG_PM_REQ_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_PM_REQ_DEVICE_STATE" },
+	{ TAG_PM_POWER_L1, RSCP_TYPE_UNKNOWN, "TAG_PM_POWER_L1" },
+	{ TAG_PM_POWER_L2, RSCP_TYPE_UNKNOWN, "TAG_PM_POWER_L2" },
+	{ TAG_PM_POWER_L3, RSCP_TYPE_UNKNOWN, "TAG_PM_POWER_L3" },
+	{ TAG_PM_ACTIVE_PHASES, RSCP_TYPE_UNKNOWN, "TAG_PM_ACTIVE_PHASES" },
+	{ TAG_PM_MODE, RSCP_TYPE_UNKNOWN, "TAG_PM_MODE" },
+	{ TAG_PM_ENERGY_L1, RSCP_TYPE_UNKNOWN, "TAG_PM_ENERGY_L1" },
+	{ TAG_PM_ENERGY_L2, RSCP_TYPE_UNKNOWN, "TAG_PM_ENERGY_L2" },
+	{ TAG_PM_ENERGY_L3, RSCP_TYPE_UNKNOWN, "TAG_PM_ENERGY_L3" },
+	{ TAG_PM_DEVICE_ID, RSCP_TYPE_UNKNOWN, "TAG_PM_DEVICE_ID" },
+	{ TAG_PM_ERROR_CODE, RSCP_TYPE_UNKNOWN, "TAG_PM_ERROR_CODE" },
+	{ TAG_PM_SET_PHASE_ELIMINATION, RSCP_TYPE_UNKNOWN, "TAG_PM_SET_PHASE_ELIMINATION" },
+	{ TAG_PM_FIRMWARE_VERSION, RSCP_TYPE_UNKNOWN, "TAG_PM_FIRMWARE_VERSION" },
+	{ TAG_PM_VOLTAGE_L1, RSCP_TYPE_UNKNOWN, "TAG_PM_VOLTAGE_L1" },
+	{ TAG_PM_VOLTAGE_L2, RSCP_TYPE_UNKNOWN, "TAG_PM_VOLTAGE_L2" },
+	{ TAG_PM_VOLTAGE_L3, RSCP_TYPE_UNKNOWN, "TAG_PM_VOLTAGE_L3" },
+	{ TAG_PM_TYPE, RSCP_TYPE_UNKNOWN, "TAG_PM_TYPE" },
+	{ TAG_PM_GET_PHASE_ELIMINATION, RSCP_TYPE_UNKNOWN, "TAG_PM_GET_PHASE_ELIMINATION" },
+	{ TAG_PM_CS_START_TIME, RSCP_TYPE_UNKNOWN, "TAG_PM_CS_START_TIME" },
+	{ TAG_PM_CS_LAST_TIME, RSCP_TYPE_UNKNOWN, "TAG_PM_CS_LAST_TIME" },
+	{ TAG_PM_CS_SUCC_FRAMES_ALL, RSCP_TYPE_UNKNOWN, "TAG_PM_CS_SUCC_FRAMES_ALL" },
+	{ TAG_PM_CS_SUCC_FRAMES_100, RSCP_TYPE_UNKNOWN, "TAG_PM_CS_SUCC_FRAMES_100" },
+	{ TAG_PM_CS_EXP_FRAMES_ALL, RSCP_TYPE_UNKNOWN, "TAG_PM_CS_EXP_FRAMES_ALL" },
+	{ TAG_PM_CS_EXP_FRAMES_100, RSCP_TYPE_UNKNOWN, "TAG_PM_CS_EXP_FRAMES_100" },
+	{ TAG_PM_CS_ERR_FRAMES_ALL, RSCP_TYPE_UNKNOWN, "TAG_PM_CS_ERR_FRAMES_ALL" },
+	{ TAG_PM_CS_ERR_FRAMES_100, RSCP_TYPE_UNKNOWN, "TAG_PM_CS_ERR_FRAMES_100" },
+	{ TAG_PM_CS_UNK_FRAMES, RSCP_TYPE_UNKNOWN, "TAG_PM_CS_UNK_FRAMES" },
+	{ TAG_PM_CS_ERR_FRAME, RSCP_TYPE_UNKNOWN, "TAG_PM_CS_ERR_FRAME" },
+	{ TAG_PM_DATA, RSCP_TYPE_UNKNOWN, "TAG_PM_DATA" },
+	{ TAG_PM_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_PM_DEVICE_STATE" },
+	{ TAG_PM_DEVICE_CONNECTED, RSCP_TYPE_UNKNOWN, "TAG_PM_DEVICE_CONNECTED" },
+	{ TAG_PM_DEVICE_WORKING, RSCP_TYPE_UNKNOWN, "TAG_PM_DEVICE_WORKING" },
+	{ TAG_PM_DEVICE_IN_SERVICE, RSCP_TYPE_UNKNOWN, "TAG_PM_DEVICE_IN_SERVICE" },
+	{ TAG_PM_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_PM_GENERAL_ERROR" },
+	{ TAG_DB_REQ_HISTORY_DATA_DAY, RSCP::eTypeContainer, "TAG_DB_REQ_HISTORY_DATA_DAY" },
+	{ TAG_DB_REQ_HISTORY_TIME_START, RSCP::eTypeTimestamp, "TAG_DB_REQ_HISTORY_TIME_START" },
+	{ TAG_DB_REQ_HISTORY_TIME_INTERVAL, RSCP::eTypeTimestamp, "TAG_DB_REQ_HISTORY_TIME_INTERVAL" },
+	{ TAG_DB_REQ_HISTORY_TIME_SPAN, RSCP::eTypeTimestamp, "TAG_DB_REQ_HISTORY_TIME_SPAN" },
+	{ TAG_DB_REQ_HISTORY_DATA_WEEK, RSCP_TYPE_UNKNOWN, "TAG_DB_REQ_HISTORY_DATA_WEEK" },
+	{ TAG_DB_REQ_HISTORY_DATA_MONTH, RSCP::eTypeContainer, "TAG_DB_REQ_HISTORY_DATA_MONTH" },
+	{ TAG_DB_REQ_HISTORY_DATA_YEAR, RSCP::eTypeContainer, "TAG_DB_REQ_HISTORY_DATA_YEAR" },
+	{ TAG_DB_GRAPH_INDEX, RSCP::eTypeFloat32, "TAG_DB_GRAPH_INDEX" },
+	{ TAG_DB_BAT_POWER_IN, RSCP::eTypeFloat32, "TAG_DB_BAT_POWER_IN" },
+	{ TAG_DB_BAT_POWER_OUT, RSCP::eTypeFloat32, "TAG_DB_BAT_POWER_OUT" },
+	{ TAG_DB_DC_POWER, RSCP::eTypeFloat32, "TAG_DB_DC_POWER" },
+	{ TAG_DB_GRID_POWER_IN, RSCP::eTypeFloat32, "TAG_DB_GRID_POWER_IN" },
+	{ TAG_DB_GRID_POWER_OUT, RSCP::eTypeFloat32, "TAG_DB_GRID_POWER_OUT" },
+	{ TAG_DB_CONSUMPTION, RSCP::eTypeFloat32, "TAG_DB_CONSUMPTION" },
+	{ TAG_DB_PM_0_POWER, RSCP::eTypeFloat32, "TAG_DB_PM_0_POWER" },
+	{ TAG_DB_PM_1_POWER, RSCP::eTypeFloat32, "TAG_DB_PM_1_POWER" },
+	{ TAG_DB_BAT_CHARGE_LEVEL, RSCP::eTypeFloat32, "TAG_DB_BAT_CHARGE_LEVEL" },
+	{ TAG_DB_BAT_CYCLE_COUNT, RSCP::eTypeFloat32, "TAG_DB_BAT_CYCLE_COUNT" },
+	{ TAG_DB_CONSUMED_PRODUCTION, RSCP::eTypeFloat32, "TAG_DB_CONSUMED_PRODUCTION" },
+	{ TAG_DB_AUTARKY, RSCP::eTypeFloat32, "TAG_DB_AUTARKY" },
+	{ TAG_DB_SUM_CONTAINER, RSCP::eTypeContainer, "TAG_DB_SUM_CONTAINER" },
+	{ TAG_DB_VALUE_CONTAINER, RSCP::eTypeContainer, "TAG_DB_VALUE_CONTAINER" },
+	{ TAG_DB_HISTORY_DATA_DAY, RSCP::eTypeContainer, "TAG_DB_HISTORY_DATA_DAY" },
+	{ TAG_DB_HISTORY_DATA_WEEK, RSCP_TYPE_UNKNOWN, "TAG_DB_HISTORY_DATA_WEEK" },
+	{ TAG_DB_HISTORY_DATA_MONTH, RSCP::eTypeContainer, "TAG_DB_HISTORY_DATA_MONTH" },
+	{ TAG_DB_HISTORY_DATA_YEAR, RSCP::eTypeContainer, "TAG_DB_HISTORY_DATA_YEAR" },
+	{ TAG_DB_PAR_TIME_MIN, RSCP_TYPE_UNKNOWN, "TAG_DB_PAR_TIME_MIN" },
+	{ TAG_DB_PAR_TIME_MAX, RSCP_TYPE_UNKNOWN, "TAG_DB_PAR_TIME_MAX" },
+	{ TAG_DB_PARAM_ROW, RSCP_TYPE_UNKNOWN, "TAG_DB_PARAM_ROW" },
+	{ TAG_DB_PARAM_COLUMN, RSCP_TYPE_UNKNOWN, "TAG_DB_PARAM_COLUMN" },
+	{ TAG_DB_PARAM_INDEX, RSCP_TYPE_UNKNOWN, "TAG_DB_PARAM_INDEX" },
+	{ TAG_DB_PARAM_VALUE, RSCP_TYPE_UNKNOWN, "TAG_DB_PARAM_VALUE" },
+	{ TAG_DB_PARAM_MAX_ROWS, RSCP_TYPE_UNKNOWN, "TAG_DB_PARAM_MAX_ROWS" },
+	{ TAG_DB_PARAM_TIME, RSCP_TYPE_UNKNOWN, "TAG_DB_PARAM_TIME" },
+	{ TAG_DB_PARAM_VERSION, RSCP_TYPE_UNKNOWN, "TAG_DB_PARAM_VERSION" },
+	{ TAG_DB_PARAM_HEADER, RSCP_TYPE_UNKNOWN, "TAG_DB_PARAM_HEADER" },
+	{ TAG_SRV_REQ_IS_ONLINE, RSCP_TYPE_UNKNOWN, "TAG_SRV_REQ_IS_ONLINE" },
+	{ TAG_SRV_REQ_ADD_USER, RSCP_TYPE_UNKNOWN, "TAG_SRV_REQ_ADD_USER" },
+	{ TAG_SRV_IS_ONLINE, RSCP_TYPE_UNKNOWN, "TAG_SRV_IS_ONLINE" },
+	{ TAG_SRV_ADD_USER, RSCP_TYPE_UNKNOWN, "TAG_SRV_ADD_USER" },
+	{ TAG_SRV_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_SRV_GENERAL_ERROR" },
+	{ TAG_HA_REQ_DATAPOINT_LIST, RSCP_TYPE_UNKNOWN, "TAG_HA_REQ_DATAPOINT_LIST" },
+	{ TAG_HA_REQ_ACTUATOR_STATES, RSCP_TYPE_UNKNOWN, "TAG_HA_REQ_ACTUATOR_STATES" },
+	{ TAG_HA_REQ_ADD_ACTUATOR, RSCP_TYPE_UNKNOWN, "TAG_HA_REQ_ADD_ACTUATOR" },
+	{ TAG_HA_REQ_REMOVE_ACTUATOR, RSCP_TYPE_UNKNOWN, "TAG_HA_REQ_REMOVE_ACTUATOR" },
+	{ TAG_HA_REQ_COMMAND_ACTUATOR, RSCP_TYPE_UNKNOWN, "TAG_HA_REQ_COMMAND_ACTUATOR" },
+	{ TAG_HA_REQ_COMMAND, RSCP_TYPE_UNKNOWN, "TAG_HA_REQ_COMMAND" },
+	{ TAG_HA_REQ_DESCRIPTIONS_CHANGE, RSCP_TYPE_UNKNOWN, "TAG_HA_REQ_DESCRIPTIONS_CHANGE" },
+	{ TAG_HA_REQ_CONFIGURATION_CHANGE_COUNTER, RSCP_TYPE_UNKNOWN, "TAG_HA_REQ_CONFIGURATION_CHANGE_COUNTER" },
+	{ TAG_HA_REQ_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_HA_REQ_DEVICE_STATE" },
+	{ TAG_HA_DATAPOINT_LIST, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_LIST" },
+	{ TAG_HA_DATAPOINT, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT" },
+	{ TAG_HA_DATAPOINT_INDEX, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_INDEX" },
+	{ TAG_HA_DATAPOINT_TYPE, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_TYPE" },
+	{ TAG_HA_DATAPOINT_NAME, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_NAME" },
+	{ TAG_HA_DATAPOINT_DESCRIPTIONS, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_DESCRIPTIONS" },
+	{ TAG_HA_DATAPOINT_DESCRIPTION, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_DESCRIPTION" },
+	{ TAG_HA_DATAPOINT_DESCRIPTION_NAME, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_DESCRIPTION_NAME" },
+	{ TAG_HA_DATAPOINT_DESCRIPTION_VALUE, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_DESCRIPTION_VALUE" },
+	{ TAG_HA_ACTUATOR_STATES, RSCP_TYPE_UNKNOWN, "TAG_HA_ACTUATOR_STATES" },
+	{ TAG_HA_DATAPOINT_STATE, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_STATE" },
+	{ TAG_HA_DATAPOINT_MODE, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_MODE" },
+	{ TAG_HA_DATAPOINT_STATE_TIMESTAMP, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_STATE_TIMESTAMP" },
+	{ TAG_HA_DATAPOINT_STATE_VALUE, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_STATE_VALUE" },
+	{ TAG_HA_DATAPOINT_SUPPLY_QUALITY, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_SUPPLY_QUALITY" },
+	{ TAG_HA_DATAPOINT_SIGNAL_QUALITY, RSCP_TYPE_UNKNOWN, "TAG_HA_DATAPOINT_SIGNAL_QUALITY" },
+	{ TAG_HA_ADD_ACTUATOR, RSCP_TYPE_UNKNOWN, "TAG_HA_ADD_ACTUATOR" },
+	{ TAG_HA_REMOVE_ACTUATOR, RSCP_TYPE_UNKNOWN, "TAG_HA_REMOVE_ACTUATOR" },
+	{ TAG_HA_COMMAND_ACTUATOR, RSCP_TYPE_UNKNOWN, "TAG_HA_COMMAND_ACTUATOR" },
+	{ TAG_HA_DESCRIPTIONS_CHANGE, RSCP_TYPE_UNKNOWN, "TAG_HA_DESCRIPTIONS_CHANGE" },
+	{ TAG_HA_CONFIGURATION_CHANGE_COUNTER, RSCP_TYPE_UNKNOWN, "TAG_HA_CONFIGURATION_CHANGE_COUNTER" },
+	{ TAG_HA_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_HA_DEVICE_STATE" },
+	{ TAG_HA_DEVICE_CONNECTED, RSCP_TYPE_UNKNOWN, "TAG_HA_DEVICE_CONNECTED" },
+	{ TAG_HA_DEVICE_WORKING, RSCP_TYPE_UNKNOWN, "TAG_HA_DEVICE_WORKING" },
+	{ TAG_HA_DEVICE_IN_SERVICE, RSCP_TYPE_UNKNOWN, "TAG_HA_DEVICE_IN_SERVICE" },
+	{ TAG_HA_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_HA_GENERAL_ERROR" },
+	{ TAG_INFO_REQ_SERIAL_NUMBER, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_SERIAL_NUMBER" },
+	{ TAG_INFO_REQ_PRODUCTION_DATE, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_PRODUCTION_DATE" },
+	{ TAG_INFO_REQ_MODULES_SW_VERSIONS, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_MODULES_SW_VERSIONS" },
+	{ TAG_INFO_REQ_A35_SERIAL_NUMBER, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_A35_SERIAL_NUMBER" },
+	{ TAG_INFO_REQ_IP_ADDRESS, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_IP_ADDRESS" },
+	{ TAG_INFO_REQ_SUBNET_MASK, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_SUBNET_MASK" },
+	{ TAG_INFO_REQ_MAC_ADDRESS, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_MAC_ADDRESS" },
+	{ TAG_INFO_REQ_GATEWAY, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_GATEWAY" },
+	{ TAG_INFO_REQ_DNS, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_DNS" },
+	{ TAG_INFO_REQ_DHCP_STATUS, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_DHCP_STATUS" },
+	{ TAG_INFO_REQ_TIME, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_TIME" },
+	{ TAG_INFO_REQ_UTC_TIME, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_UTC_TIME" },
+	{ TAG_INFO_REQ_TIME_ZONE, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_TIME_ZONE" },
+	{ TAG_INFO_REQ_INFO, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_INFO" },
+	{ TAG_INFO_REQ_SET_IP_ADDRESS, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_SET_IP_ADDRESS" },
+	{ TAG_INFO_REQ_SET_SUBNET_MASK, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_SET_SUBNET_MASK" },
+	{ TAG_INFO_REQ_SET_DHCP_STATUS, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_SET_DHCP_STATUS" },
+	{ TAG_INFO_REQ_SET_GATEWAY, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_SET_GATEWAY" },
+	{ TAG_INFO_REQ_SET_DNS, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_SET_DNS" },
+	{ TAG_INFO_REQ_SET_TIME_ZONE, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_SET_TIME_ZONE" },
+	{ TAG_INFO_REQ_SW_RELEASE, RSCP_TYPE_UNKNOWN, "TAG_INFO_REQ_SW_RELEASE" },
+	{ TAG_INFO_SERIAL_NUMBER, RSCP_TYPE_UNKNOWN, "TAG_INFO_SERIAL_NUMBER" },
+	{ TAG_INFO_PRODUCTION_DATE, RSCP_TYPE_UNKNOWN, "TAG_INFO_PRODUCTION_DATE" },
+	{ TAG_INFO_MODULES_SW_VERSIONS, RSCP_TYPE_UNKNOWN, "TAG_INFO_MODULES_SW_VERSIONS" },
+	{ TAG_INFO_MODULE_SW_VERSION, RSCP_TYPE_UNKNOWN, "TAG_INFO_MODULE_SW_VERSION" },
+	{ TAG_INFO_MODULE, RSCP_TYPE_UNKNOWN, "TAG_INFO_MODULE" },
+	{ TAG_INFO_VERSION, RSCP_TYPE_UNKNOWN, "TAG_INFO_VERSION" },
+	{ TAG_INFO_A35_SERIAL_NUMBER, RSCP_TYPE_UNKNOWN, "TAG_INFO_A35_SERIAL_NUMBER" },
+	{ TAG_INFO_IP_ADDRESS, RSCP_TYPE_UNKNOWN, "TAG_INFO_IP_ADDRESS" },
+	{ TAG_INFO_SUBNET_MASK, RSCP_TYPE_UNKNOWN, "TAG_INFO_SUBNET_MASK" },
+	{ TAG_INFO_MAC_ADDRESS, RSCP_TYPE_UNKNOWN, "TAG_INFO_MAC_ADDRESS" },
+	{ TAG_INFO_GATEWAY, RSCP_TYPE_UNKNOWN, "TAG_INFO_GATEWAY" },
+	{ TAG_INFO_DNS, RSCP_TYPE_UNKNOWN, "TAG_INFO_DNS" },
+	{ TAG_INFO_DHCP_STATUS, RSCP_TYPE_UNKNOWN, "TAG_INFO_DHCP_STATUS" },
+	{ TAG_INFO_TIME, RSCP_TYPE_UNKNOWN, "TAG_INFO_TIME" },
+	{ TAG_INFO_UTC_TIME, RSCP_TYPE_UNKNOWN, "TAG_INFO_UTC_TIME" },
+	{ TAG_INFO_TIME_ZONE, RSCP_TYPE_UNKNOWN, "TAG_INFO_TIME_ZONE" },
+	{ TAG_INFO_INFO, RSCP_TYPE_UNKNOWN, "TAG_INFO_INFO" },
+	{ TAG_INFO_SET_IP_ADDRESS, RSCP_TYPE_UNKNOWN, "TAG_INFO_SET_IP_ADDRESS" },
+	{ TAG_INFO_SET_SUBNET_MASK, RSCP_TYPE_UNKNOWN, "TAG_INFO_SET_SUBNET_MASK" },
+	{ TAG_INFO_SET_DHCP_STATUS, RSCP_TYPE_UNKNOWN, "TAG_INFO_SET_DHCP_STATUS" },
+	{ TAG_INFO_SET_GATEWAY, RSCP_TYPE_UNKNOWN, "TAG_INFO_SET_GATEWAY" },
+	{ TAG_INFO_SET_DNS, RSCP_TYPE_UNKNOWN, "TAG_INFO_SET_DNS" },
+	{ TAG_INFO_SET_TIME, RSCP_TYPE_UNKNOWN, "TAG_INFO_SET_TIME" },
+	{ TAG_INFO_SET_TIME_ZONE, RSCP_TYPE_UNKNOWN, "TAG_INFO_SET_TIME_ZONE" },
+	{ TAG_INFO_SW_RELEASE, RSCP_TYPE_UNKNOWN, "TAG_INFO_SW_RELEASE" },
+	{ TAG_INFO_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_INFO_GENERAL_ERROR" },
+	{ TAG_EP_REQ_IS_READY_FOR_SWITCH, RSCP_TYPE_UNKNOWN, "TAG_EP_REQ_IS_READY_FOR_SWITCH" },
+	{ TAG_EP_REQ_IS_GRID_CONNECTED, RSCP_TYPE_UNKNOWN, "TAG_EP_REQ_IS_GRID_CONNECTED" },
+	{ TAG_EP_REQ_IS_ISLAND_GRID, RSCP_TYPE_UNKNOWN, "TAG_EP_REQ_IS_ISLAND_GRID" },
+	{ TAG_EP_REQ_IS_INVALID_STATE, RSCP_TYPE_UNKNOWN, "TAG_EP_REQ_IS_INVALID_STATE" },
+	{ TAG_EP_REQ_IS_POSSIBLE, RSCP_TYPE_UNKNOWN, "TAG_EP_REQ_IS_POSSIBLE" },
+	{ TAG_EP_IS_READY_FOR_SWITCH, RSCP_TYPE_UNKNOWN, "TAG_EP_IS_READY_FOR_SWITCH" },
+	{ TAG_EP_IS_GRID_CONNECTED, RSCP_TYPE_UNKNOWN, "TAG_EP_IS_GRID_CONNECTED" },
+	{ TAG_EP_IS_ISLAND_GRID, RSCP_TYPE_UNKNOWN, "TAG_EP_IS_ISLAND_GRID" },
+	{ TAG_EP_IS_INVALID_STATE, RSCP_TYPE_UNKNOWN, "TAG_EP_IS_INVALID_STATE" },
+	{ TAG_EP_IS_POSSIBLE, RSCP_TYPE_UNKNOWN, "TAG_EP_IS_POSSIBLE" },
+	{ TAG_EP_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_EP_GENERAL_ERROR" },
+	{ TAG_SYS_REQ_SYSTEM_REBOOT, RSCP_TYPE_UNKNOWN, "TAG_SYS_REQ_SYSTEM_REBOOT" },
+	{ TAG_SYS_REQ_IS_SYSTEM_REBOOTING, RSCP_TYPE_UNKNOWN, "TAG_SYS_REQ_IS_SYSTEM_REBOOTING" },
+	{ TAG_SYS_REQ_RESTART_APPLICATION, RSCP_TYPE_UNKNOWN, "TAG_SYS_REQ_RESTART_APPLICATION" },
+	{ TAG_SYS_SYSTEM_REBOOT, RSCP_TYPE_UNKNOWN, "TAG_SYS_SYSTEM_REBOOT" },
+	{ TAG_SYS_IS_SYSTEM_REBOOTING, RSCP_TYPE_UNKNOWN, "TAG_SYS_IS_SYSTEM_REBOOTING" },
+	{ TAG_SYS_RESTART_APPLICATION, RSCP_TYPE_UNKNOWN, "TAG_SYS_RESTART_APPLICATION" },
+	{ TAG_SYS_SCRIPT_FILE, RSCP_TYPE_UNKNOWN, "TAG_SYS_SCRIPT_FILE" },
+	{ TAG_SYS_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_SYS_GENERAL_ERROR" },
+	{ TAG_UM_REQ_UPDATE_STATUS, RSCP_TYPE_UNKNOWN, "TAG_UM_REQ_UPDATE_STATUS" },
+	{ TAG_UM_REQ_CHECK_FOR_UPDATES, RSCP_TYPE_UNKNOWN, "TAG_UM_REQ_CHECK_FOR_UPDATES" },
+	{ TAG_UM_UPDATE_STATUS, RSCP_TYPE_UNKNOWN, "TAG_UM_UPDATE_STATUS" },
+	{ TAG_UM_CHECK_FOR_UPDATES, RSCP_TYPE_UNKNOWN, "TAG_UM_CHECK_FOR_UPDATES" },
+	{ TAG_UM_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_UM_GENERAL_ERROR" },
+	{ TAG_WB_REQ_ENERGY_ALL, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_ENERGY_ALL" },
+	{ TAG_WB_REQ_ENERGY_SOLAR, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_ENERGY_SOLAR" },
+	{ TAG_WB_REQ_SOC, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_SOC" },
+	{ TAG_WB_REQ_STATUS, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_STATUS" },
+	{ TAG_WB_REQ_ERROR_CODE, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_ERROR_CODE" },
+	{ TAG_WB_REQ_MODE, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_MODE" },
+	{ TAG_WB_REQ_APP_SOFTWARE, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_APP_SOFTWARE" },
+	{ TAG_WB_REQ_BOOTLOADER_SOFTWARE, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_BOOTLOADER_SOFTWARE" },
+	{ TAG_WB_REQ_HW_VERSION, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_HW_VERSION" },
+	{ TAG_WB_REQ_FLASH_VERSION, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_FLASH_VERSION" },
+	{ TAG_WB_REQ_DEVICE_ID, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_DEVICE_ID" },
+	{ TAG_WB_REQ_PM_POWER_L1, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_POWER_L1" },
+	{ TAG_WB_REQ_PM_POWER_L2, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_POWER_L2" },
+	{ TAG_WB_REQ_PM_POWER_L3, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_POWER_L3" },
+	{ TAG_WB_REQ_PM_ACTIVE_PHASES, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_ACTIVE_PHASES" },
+	{ TAG_WB_REQ_PM_MODE, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_MODE" },
+	{ TAG_WB_REQ_PM_ENERGY_L1, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_ENERGY_L1" },
+	{ TAG_WB_REQ_PM_ENERGY_L2, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_ENERGY_L2" },
+	{ TAG_WB_REQ_PM_ENERGY_L3, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_ENERGY_L3" },
+	{ TAG_WB_REQ_PM_DEVICE_ID, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_DEVICE_ID" },
+	{ TAG_WB_REQ_PM_ERROR_CODE, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_ERROR_CODE" },
+	{ TAG_WB_REQ_PM_FIRMWARE_VERSION, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_FIRMWARE_VERSION" },
+	{ TAG_WB_REQ_DIAG_INFOS, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_DIAG_INFOS" },
+	{ TAG_WB_REQ_DIAG_WARNINGS, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_DIAG_WARNINGS" },
+	{ TAG_WB_REQ_DIAG_ERRORS, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_DIAG_ERRORS" },
+	{ TAG_WB_REQ_DIAG_TEMP_1, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_DIAG_TEMP_1" },
+	{ TAG_WB_REQ_DIAG_TEMP_2, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_DIAG_TEMP_2" },
+	{ TAG_WB_REQ_PM_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PM_DEVICE_STATE" },
+	{ TAG_WB_REQ_SET_MODE, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_SET_MODE" },
+	{ TAG_WB_SET_MODE, RSCP_TYPE_UNKNOWN, "TAG_WB_SET_MODE" },
+	{ TAG_WB_REQ_DATA, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_DATA" },
+	{ TAG_WB_INDEX, RSCP_TYPE_UNKNOWN, "TAG_WB_INDEX" },
+	{ TAG_WB_MODE_PARAM_MODE, RSCP_TYPE_UNKNOWN, "TAG_WB_MODE_PARAM_MODE" },
+	{ TAG_WB_MODE_PARAM_MAX_CURRENT, RSCP_TYPE_UNKNOWN, "TAG_WB_MODE_PARAM_MAX_CURRENT" },
+	{ TAG_WB_REQ_AVAILABLE_SOLAR_POWER, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_AVAILABLE_SOLAR_POWER" },
+	{ TAG_WB_POWER, RSCP_TYPE_UNKNOWN, "TAG_WB_POWER" },
+	{ TAG_WB_STATUS_BIT, RSCP_TYPE_UNKNOWN, "TAG_WB_STATUS_BIT" },
+	{ TAG_WB_REQ_SET_EXTERN, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_SET_EXTERN" },
+	{ TAG_WB_REQ_EXTERN_DATA_SUN, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_EXTERN_DATA_SUN" },
+	{ TAG_WB_REQ_EXTERN_DATA_NET, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_EXTERN_DATA_NET" },
+	{ TAG_WB_REQ_EXTERN_DATA_ALL, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_EXTERN_DATA_ALL" },
+	{ TAG_WB_REQ_EXTERN_DATA_ALG, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_EXTERN_DATA_ALG" },
+	{ TAG_WB_REQ_SET_BAT_CAPACITY, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_SET_BAT_CAPACITY" },
+	{ TAG_WB_REQ_SET_PARAM_1, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_SET_PARAM_1" },
+	{ TAG_WB_REQ_SET_PARAM_2, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_SET_PARAM_2" },
+	{ TAG_WB_REQ_PARAM_2, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PARAM_2" },
+	{ TAG_WB_REQ_PARAM_1, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_PARAM_1" },
+	{ TAG_WB_EXTERN_DATA, RSCP_TYPE_UNKNOWN, "TAG_WB_EXTERN_DATA" },
+	{ TAG_WB_EXTERN_DATA_LEN, RSCP_TYPE_UNKNOWN, "TAG_WB_EXTERN_DATA_LEN" },
+	{ TAG_WB_REQ_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_WB_REQ_DEVICE_STATE" },
+	{ TAG_WB_ENERGY_ALL, RSCP_TYPE_UNKNOWN, "TAG_WB_ENERGY_ALL" },
+	{ TAG_WB_ENERGY_SOLAR, RSCP_TYPE_UNKNOWN, "TAG_WB_ENERGY_SOLAR" },
+	{ TAG_WB_SOC, RSCP_TYPE_UNKNOWN, "TAG_WB_SOC" },
+	{ TAG_WB_STATUS, RSCP_TYPE_UNKNOWN, "TAG_WB_STATUS" },
+	{ TAG_WB_ERROR_CODE, RSCP_TYPE_UNKNOWN, "TAG_WB_ERROR_CODE" },
+	{ TAG_WB_MODE, RSCP_TYPE_UNKNOWN, "TAG_WB_MODE" },
+	{ TAG_WB_APP_SOFTWARE, RSCP_TYPE_UNKNOWN, "TAG_WB_APP_SOFTWARE" },
+	{ TAG_WB_BOOTLOADER_SOFTWARE, RSCP_TYPE_UNKNOWN, "TAG_WB_BOOTLOADER_SOFTWARE" },
+	{ TAG_WB_HW_VERSION, RSCP_TYPE_UNKNOWN, "TAG_WB_HW_VERSION" },
+	{ TAG_WB_FLASH_VERSION, RSCP_TYPE_UNKNOWN, "TAG_WB_FLASH_VERSION" },
+	{ TAG_WB_DEVICE_ID, RSCP_TYPE_UNKNOWN, "TAG_WB_DEVICE_ID" },
+	{ TAG_WB_PM_POWER_L1, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_POWER_L1" },
+	{ TAG_WB_PM_POWER_L2, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_POWER_L2" },
+	{ TAG_WB_PM_POWER_L3, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_POWER_L3" },
+	{ TAG_WB_PM_ACTIVE_PHASES, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_ACTIVE_PHASES" },
+	{ TAG_WB_PM_MODE, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_MODE" },
+	{ TAG_WB_PM_ENERGY_L1, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_ENERGY_L1" },
+	{ TAG_WB_PM_ENERGY_L2, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_ENERGY_L2" },
+	{ TAG_WB_PM_ENERGY_L3, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_ENERGY_L3" },
+	{ TAG_WB_PM_DEVICE_ID, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_DEVICE_ID" },
+	{ TAG_WB_PM_ERROR_CODE, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_ERROR_CODE" },
+	{ TAG_WB_PM_FIRMWARE_VERSION, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_FIRMWARE_VERSION" },
+	{ TAG_WB_DIAG_INFOS, RSCP_TYPE_UNKNOWN, "TAG_WB_DIAG_INFOS" },
+	{ TAG_WB_DIAG_WARNINGS, RSCP_TYPE_UNKNOWN, "TAG_WB_DIAG_WARNINGS" },
+	{ TAG_WB_DIAG_ERRORS, RSCP_TYPE_UNKNOWN, "TAG_WB_DIAG_ERRORS" },
+	{ TAG_WB_DIAG_TEMP_1, RSCP_TYPE_UNKNOWN, "TAG_WB_DIAG_TEMP_1" },
+	{ TAG_WB_DIAG_TEMP_2, RSCP_TYPE_UNKNOWN, "TAG_WB_DIAG_TEMP_2" },
+	{ TAG_WB_PM_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_DEVICE_STATE" },
+	{ TAG_WB_PM_DEVICE_STATE_CONNECTED, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_DEVICE_STATE_CONNECTED" },
+	{ TAG_WB_PM_DEVICE_STATE_WORKING, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_DEVICE_STATE_WORKING" },
+	{ TAG_WB_PM_DEVICE_STATE_IN_SERVICE, RSCP_TYPE_UNKNOWN, "TAG_WB_PM_DEVICE_STATE_IN_SERVICE" },
+	{ TAG_WB_DATA, RSCP_TYPE_UNKNOWN, "TAG_WB_DATA" },
+	{ TAG_WB_AVAILABLE_SOLAR_POWER, RSCP_TYPE_UNKNOWN, "TAG_WB_AVAILABLE_SOLAR_POWER" },
+	{ TAG_WB_SET_EXTERN, RSCP_TYPE_UNKNOWN, "TAG_WB_SET_EXTERN" },
+	{ TAG_WB_EXTERN_DATA_SUN, RSCP_TYPE_UNKNOWN, "TAG_WB_EXTERN_DATA_SUN" },
+	{ TAG_WB_EXTERN_DATA_NET, RSCP_TYPE_UNKNOWN, "TAG_WB_EXTERN_DATA_NET" },
+	{ TAG_WB_EXTERN_DATA_ALL, RSCP_TYPE_UNKNOWN, "TAG_WB_EXTERN_DATA_ALL" },
+	{ TAG_WB_EXTERN_DATA_ALG, RSCP_TYPE_UNKNOWN, "TAG_WB_EXTERN_DATA_ALG" },
+	{ TAG_WB_SET_BAT_CAPACITY, RSCP_TYPE_UNKNOWN, "TAG_WB_SET_BAT_CAPACITY" },
+	{ TAG_WB_SET_PARAM_1, RSCP_TYPE_UNKNOWN, "TAG_WB_SET_PARAM_1" },
+	{ TAG_WB_SET_PARAM_2, RSCP_TYPE_UNKNOWN, "TAG_WB_SET_PARAM_2" },
+	{ TAG_WB_RSP_PARAM_2, RSCP_TYPE_UNKNOWN, "TAG_WB_RSP_PARAM_2" },
+	{ TAG_WB_RSP_PARAM_1, RSCP_TYPE_UNKNOWN, "TAG_WB_RSP_PARAM_1" },
+	{ TAG_WB_DEVICE_STATE, RSCP_TYPE_UNKNOWN, "TAG_WB_DEVICE_STATE" },
+	{ TAG_WB_DEVICE_CONNECTED, RSCP_TYPE_UNKNOWN, "TAG_WB_DEVICE_CONNECTED" },
+	{ TAG_WB_DEVICE_WORKING, RSCP_TYPE_UNKNOWN, "TAG_WB_DEVICE_WORKING" },
+	{ TAG_WB_DEVICE_IN_SERVICE, RSCP_TYPE_UNKNOWN, "TAG_WB_DEVICE_IN_SERVICE" },
+	{ TAG_WB_GENERAL_ERROR, RSCP_TYPE_UNKNOWN, "TAG_WB_GENERAL_ERROR" },
+};
+
+constexpr uint32_t tagCount = sizeof(tags) / sizeof(tags[0]);
+
+// names of the namespaces (most significant byte of the tag)
+constexpr const char * nameSpaces[] = {
+	"RSCP",
+	"EMS",
+	"PVI",
+	"BAT",
+	"DCDC",
+	"PM",
+	"DB",
+	NULL,
+	"SRV",
+	"HA",
+	"INFO",
+	"EP",
+	"SYS",
+	"UM",
+	"WB",
+};
+
+// perfect hash of the tags, slots holds the index into tags + 1 (0 = empty)
+constexpr uint32_t hashMul1 = 0x9E3779B1;
+constexpr uint32_t hashMul2 = 0x85EBCA77;
+constexpr uint16_t displacement[256] = {
+	0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 2, 6, 0, 0, 0, 1,
+	0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 2, 2, 4, 2, 5, 0,
+	1, 0, 0, 1, 1, 0, 0, 3, 2, 0, 2, 0, 2, 0, 1, 2,
+	2, 2, 0, 0, 0, 0, 0, 1, 0, 1, 1, 5, 0, 0, 1, 1,
+	0, 2, 1, 1, 0, 0, 0, 8, 3, 5, 1, 2, 0, 0, 0, 0,
+	5, 0, 2, 3, 0, 0, 0, 1, 3, 1, 0, 4, 13, 7, 0, 2,
+	0, 1, 4, 3, 0, 5, 0, 5, 0, 1, 0, 4, 8, 0, 0, 2,
+	0, 0, 2, 2, 1, 0, 1, 0, 5, 0, 4, 0, 3, 4, 0, 4,
+	5, 0, 0, 0, 11, 0, 6, 3, 0, 1, 0, 7, 1, 7, 0, 14,
+	1, 17, 0, 6, 1, 0, 0, 2, 5, 1, 2, 0, 4, 4, 0, 0,
+	0, 0, 0, 1, 2, 1, 8, 0, 2, 3, 1, 6, 0, 3, 2, 0,
+	0, 0, 0, 1, 10, 0, 2, 8, 1, 1, 3, 4, 4, 1, 16, 5,
+	8, 17, 0, 5, 5, 0, 0, 3, 1, 0, 1, 12, 0, 1, 6, 0,
+	0, 6, 0, 2, 0, 2, 0, 10, 1, 0, 2, 0, 6, 0, 6, 1,
+	1, 3, 0, 0, 0, 0, 0, 8, 1, 0, 1, 1, 7, 0, 6, 1,
+	10, 8, 3, 1, 3, 0, 5, 0, 11, 0, 13, 1, 0, 2, 5, 0,
+};
+constexpr uint16_t slots[1024] = {
+	0, 93, 656, 0, 567, 0, 0, 249, 270, 0, 665, 400, 627, 676, 321, 0,
+	417, 602, 27, 523, 537, 423, 353, 112, 0, 0, 643, 0, 160, 84, 463, 582,
+	373, 390, 489, 482, 12, 630, 0, 0, 201, 0, 64, 0, 0, 344, 44, 2,
+	658, 0, 0, 0, 251, 0, 0, 214, 0, 272, 667, 568, 0, 678, 323, 0,
+	0, 645, 525, 29, 443, 425, 0, 401, 86, 539, 491, 162, 114, 375, 465, 584,
+	402, 285, 392, 14, 0, 234, 46, 0, 66, 308, 184, 4, 196, 203, 281, 346,
+	0, 0, 325, 216, 38, 253, 569, 0, 51, 274, 0, 669, 0, 0, 0, 0,
+	0, 527, 418, 31, 445, 427, 467, 116, 541, 0, 310, 0, 0, 231, 586, 493,
+	300, 16, 510, 404, 0, 68, 236, 48, 0, 282, 0, 186, 357, 348, 0, 286,
+	0, 0, 166, 53, 218, 611, 0, 571, 287, 276, 0, 177, 0, 0, 501, 0,
+	0, 529, 543, 118, 506, 447, 312, 33, 648, 0, 0, 0, 0, 588, 0, 511,
+	406, 18, 0, 0, 0, 133, 0, 0, 153, 70, 481, 0, 359, 469, 0, 349,
+	168, 659, 0, 0, 220, 278, 55, 613, 179, 289, 0, 671, 0, 0, 0, 650,
+	545, 35, 559, 120, 225, 530, 508, 314, 0, 449, 513, 394, 205, 590, 164, 408,
+	0, 0, 99, 0, 0, 72, 135, 0, 0, 0, 351, 0, 361, 0, 170, 436,
+	94, 222, 673, 0, 0, 0, 57, 471, 291, 0, 181, 0, 605, 0, 0, 652,
+	451, 547, 122, 631, 207, 376, 316, 561, 592, 0, 0, 0, 632, 0, 396, 410,
+	504, 101, 0, 434, 0, 137, 74, 0, 0, 0, 244, 362, 0, 0, 438, 0,
+	0, 96, 0, 0, 0, 255, 293, 327, 0, 0, 0, 0, 479, 607, 0, 0,
+	549, 124, 209, 453, 620, 0, 430, 614, 0, 594, 495, 0, 634, 514, 412, 0,
+	103, 0, 0, 139, 0, 0, 76, 0, 0, 304, 0, 364, 7, 238, 0, 0,
+	0, 0, 0, 144, 257, 572, 329, 295, 337, 0, 551, 0, 0, 0, 0, 211,
+	0, 0, 0, 0, 432, 622, 0, 0, 636, 0, 596, 126, 497, 516, 20, 105,
+	378, 0, 0, 141, 0, 78, 0, 305, 0, 0, 366, 383, 0, 333, 661, 193,
+	0, 331, 0, 338, 146, 574, 0, 259, 0, 229, 88, 553, 0, 0, 297, 213,
+	128, 624, 0, 455, 0, 0, 0, 0, 597, 638, 483, 499, 22, 532, 518, 107,
+	380, 0, 616, 0, 0, 172, 155, 80, 368, 0, 385, 0, 335, 98, 0, 195,
+	0, 280, 261, 59, 148, 0, 299, 340, 240, 0, 130, 90, 555, 0, 0, 246,
+	0, 318, 599, 267, 679, 0, 0, 564, 520, 534, 640, 24, 414, 0, 109, 173,
+	0, 420, 618, 0, 82, 189, 0, 157, 387, 486, 0, 0, 370, 0, 0, 41,
+	473, 0, 61, 263, 441, 150, 342, 0, 92, 242, 0, 655, 0, 0, 0, 248,
+	320, 675, 566, 0, 26, 269, 626, 399, 642, 522, 416, 601, 536, 111, 422, 175,
+	0, 0, 0, 83, 0, 159, 462, 190, 488, 389, 629, 11, 372, 0, 43, 0,
+	0, 0, 63, 0, 576, 200, 182, 1, 0, 0, 657, 0, 0, 250, 502, 0,
+	322, 0, 666, 271, 677, 628, 0, 644, 603, 442, 538, 113, 354, 28, 524, 424,
+	85, 307, 477, 191, 161, 440, 583, 464, 490, 391, 13, 284, 374, 0, 45, 0,
+	0, 65, 0, 577, 183, 3, 345, 202, 37, 0, 0, 0, 252, 0, 0, 215,
+	324, 273, 668, 50, 0, 646, 0, 0, 526, 540, 115, 30, 557, 444, 426, 0,
+	163, 67, 309, 87, 0, 466, 585, 492, 403, 393, 15, 355, 235, 47, 0, 0,
+	0, 165, 0, 185, 356, 347, 5, 197, 0, 578, 52, 610, 217, 254, 39, 570,
+	670, 326, 275, 0, 117, 176, 0, 439, 647, 528, 542, 505, 446, 428, 32, 311,
+	664, 0, 0, 0, 468, 587, 0, 0, 405, 17, 0, 171, 237, 0, 0, 0,
+	152, 0, 301, 0, 283, 358, 475, 480, 0, 204, 167, 0, 219, 69, 612, 54,
+	119, 178, 288, 199, 277, 544, 0, 0, 649, 448, 34, 558, 224, 507, 313, 49,
+	0, 0, 0, 0, 0, 589, 470, 512, 407, 19, 0, 0, 0, 134, 71, 0,
+	435, 0, 302, 350, 460, 360, 169, 198, 575, 476, 0, 0, 0, 221, 56, 0,
+	290, 429, 121, 672, 206, 0, 604, 651, 36, 546, 560, 450, 509, 226, 315, 531,
+	0, 180, 591, 0, 232, 0, 409, 395, 0, 100, 0, 0, 0, 73, 0, 136,
+	230, 303, 95, 243, 6, 0, 0, 437, 223, 0, 472, 456, 0, 58, 674, 0,
+	292, 0, 0, 0, 0, 606, 0, 653, 548, 208, 123, 452, 619, 0, 0, 562,
+	233, 459, 0, 397, 593, 633, 411, 494, 102, 332, 0, 0, 0, 138, 75, 0,
+	0, 363, 352, 579, 381, 0, 0, 0, 97, 0, 132, 0, 143, 256, 328, 294,
+	0, 0, 0, 0, 608, 0, 0, 0, 125, 454, 210, 227, 431, 550, 621, 615,
+	0, 0, 0, 595, 635, 515, 496, 413, 377, 104, 77, 140, 0, 0, 0, 0,
+	0, 580, 365, 382, 660, 8, 192, 0, 0, 145, 258, 330, 0, 573, 296, 0,
+	0, 0, 0, 0, 458, 0, 552, 212, 127, 0, 228, 623, 433, 265, 0, 0,
+	0, 637, 0, 498, 517, 398, 21, 106, 0, 379, 306, 187, 154, 79, 0, 0,
+	367, 0, 0, 384, 194, 503, 662, 334, 0, 260, 0, 279, 147, 663, 298, 339,
+	0, 239, 0, 0, 89, 0, 554, 245, 129, 563, 0, 266, 0, 142, 317, 0,
+	533, 478, 500, 598, 519, 23, 639, 484, 617, 81, 0, 0, 156, 188, 108, 419,
+	0, 485, 369, 386, 336, 457, 40, 9, 0, 0, 262, 60, 149, 0, 341, 0,
+	241, 131, 0, 609, 654, 247, 556, 91, 565, 625, 319, 268, 0, 0, 0, 0,
+	25, 535, 0, 600, 415, 110, 421, 174, 641, 0, 0, 0, 0, 158, 0, 461,
+	388, 581, 521, 10, 0, 371, 487, 42, 0, 474, 62, 151, 264, 0, 343, 0,
+};
+
+// slot of \var tag in slots
+constexpr uint32_t slot(SRscpTag tag) {
+	return (((uint32_t) (tag * hashMul2) >> 22) ^ displacement[(uint32_t) (tag * hashMul1) >> 24]) & 1023;
+}
+
+/*
+ * \brief Entry of \var tag or NULL if the tag is not known. Two multiplications and two table reads.
+ */
+constexpr const SRscpTagInfo * find(SRscpTag tag) {
+	uint16_t index = slots[slot(tag)];
+	return ((index != 0) && (tags[index - 1].tag == tag)) ? &tags[index - 1] : NULL;
+}
+
+/*
+ * \brief Name of \var tag (e.g. "TAG_EMS_POWER_PV") or NULL if the tag is not known.
+ */
+constexpr const char * name(SRscpTag tag) {
+	return (find(tag) != NULL) ? find(tag)->name : NULL;
+}
+
+/*
+ * \brief Expected RSCP::eRscpDataType of \var tag or RSCP_TYPE_UNKNOWN.
+ */
+constexpr uint8_t dataType(SRscpTag tag) {
+	return (find(tag) != NULL) ? find(tag)->dataType : RSCP_TYPE_UNKNOWN;
+}
+
+/*
+ * \brief Namespace of \var tag (e.g. 0x01) and its name (e.g. "EMS" or NULL if not known).
+ */
+constexpr uint8_t nameSpace(SRscpTag tag) {
+	return tag >> 24;
+}
+constexpr const char * nameSpaceName(SRscpTag tag) {
+	return (nameSpace(tag) < sizeof(nameSpaces) / sizeof(nameSpaces[0])) ? nameSpaces[nameSpace(tag)] : NULL;
+}
+
+} // namespace RscpTagSchema
+
+#endif /* RSCPTAGSCHEMA_H_ */
@@ -0,0 +1,97 @@
+//============================================================================
+// Name        : RscpTimerWheel.cpp
+// Description : Hashed timer wheel for the timeouts of many connections
+//============================================================================
+
+#include <time.h>
+#include "RscpTimerWheel.h"
+
+RscpTimerWheel::RscpTimerWheel(uint32_t tickMs) :
+		tickMs((tickMs > 0) ? tickMs : 1), count(0) {
+	currentTick = toTick(now());
+	for (int i = 0; i < RSCP_TIMER_SLOTS; i++) {
+		slots[i].prev = &slots[i];
+		slots[i].next = &slots[i];
+		slots[i].expires = 0;
+		slots[i].owner = NULL;
+	}
+}
+
+void RscpTimerWheel::init(SRscpTimer * timer, void * owner) {
+	timer->prev = NULL;
+	timer->next = NULL;
+	timer->expires = 0;
+	timer->owner = owner;
+}
+
+uint64_t RscpTimerWheel::now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+void RscpTimerWheel::schedule(SRscpTimer * timer, uint64_t now, uint32_t ms) {
+	cancel(timer);
+	// round up, a timer never expires early
+	timer->expires = toTick(now + ms + tickMs - 1);
+	if (timer->expires <= currentTick) {
+		timer->expires = currentTick + 1;
+	}
+	SRscpTimer * head = &slots[timer->expires & (RSCP_TIMER_SLOTS - 1)];
+	timer->prev = head->prev;
+	timer->next = head;
+	head->prev->next = timer;
+	head->prev = timer;
+	count++;
+}
+
+void RscpTimerWheel::cancel(SRscpTimer * timer) {
+	if (!isScheduled(timer)) {
+		return;
+	}
+	timer->prev->next = timer->next;
+	timer->next->prev = timer->prev;
+	timer->prev = NULL;
+	timer->next = NULL;
+	count--;
+}
+
+void RscpTimerWheel::advance(uint64_t now, std::vector<SRscpTimer *> & expired) {
+	uint64_t tick = toTick(now);
+	// after a whole turn every slot was visited, the timers of later turns stay in their slot
+	uint64_t first = currentTick + 1;
+	if (tick >= first + RSCP_TIMER_SLOTS) {
+		first = tick - RSCP_TIMER_SLOTS + 1;
+	}
+	for (uint64_t t = first; (t <= tick) && (count > 0); t++) {
+		SRscpTimer * head = &slots[t & (RSCP_TIMER_SLOTS - 1)];
+		SRscpTimer * timer = head->next;
+		while (timer != head) {
+			SRscpTimer * next = timer->next;
+			if (timer->expires <= tick) {
+				cancel(timer);
+				expired.push_back(timer);
+			}
+			timer = next;
+		}
+	}
+	if (tick > currentTick) {
+		currentTick = tick;
+	}
+}
+
+int RscpTimerWheel::getTimeout(uint64_t now) const {
+	if (count == 0) {
+		return -1;
+	}
+	// the first slot with a timer; it may belong to a later turn, then the wait is just shorter than needed
+	uint64_t t = currentTick + 1;
+	for (int i = 0; i < RSCP_TIMER_SLOTS; i++, t++) {
+		const SRscpTimer * head = &slots[t & (RSCP_TIMER_SLOTS - 1)];
+		if (head->next != head) {
+			break;
+		}
+	}
+	uint64_t next = t * tickMs;
+	return (next > now) ? (int) (next - now) : 0;
+}
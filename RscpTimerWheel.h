@@ -0,0 +1,79 @@
+//============================================================================
+// Name        : RscpTimerWheel.h
+// Description : Hashed timer wheel for the timeouts of many connections.
+//             : Scheduling, rescheduling and cancelling are O(1), the
+//             : timers are linked into the slots and allocate nothing.
+//============================================================================
+
+#ifndef RSCPTIMERWHEEL_H_
+#define RSCPTIMERWHEEL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// slots of the wheel, a power of 2; one turn is RSCP_TIMER_SLOTS ticks
+#define RSCP_TIMER_SLOTS 256
+
+/*
+ * A timer is embedded in the object it belongs to, \var owner points back to it.
+ */
+struct SRscpTimer {
+	SRscpTimer * prev;
+	SRscpTimer * next;
+	uint64_t expires;   // tick the timer expires at
+	void * owner;
+};
+
+class RscpTimerWheel {
+public:
+    /*
+     * Constructor
+     * @param tickMs - Resolution of the timers in milliseconds
+     */
+	RscpTimerWheel(uint32_t tickMs = 100);
+    /*
+     * \brief Prepare \var timer for use, it is not scheduled.
+     */
+	static void init(SRscpTimer * timer, void * owner);
+    /*
+     * \brief (Re)schedule \var timer to expire \var ms milliseconds after \var now.
+     */
+	void schedule(SRscpTimer * timer, uint64_t now, uint32_t ms);
+    /*
+     * \brief Remove \var timer from the wheel, nothing happens if it is not scheduled.
+     */
+	void cancel(SRscpTimer * timer);
+	static bool isScheduled(const SRscpTimer * timer) {
+		return timer->next != NULL;
+	}
+    /*
+     * \brief Advance the wheel to \var now and move all timers that expired up to then to \var expired.
+     *        The expired timers are not scheduled any more.
+     */
+	void advance(uint64_t now, std::vector<SRscpTimer *> & expired);
+    /*
+     * \brief Milliseconds from \var now until the next tick with a timer at most, -1 if no timer is scheduled.
+     *        Suitable as timeout of epoll_wait().
+     */
+	int getTimeout(uint64_t now) const;
+	size_t size() const {
+		return count;
+	}
+    /*
+     * \brief Monotonic clock in milliseconds.
+     */
+	static uint64_t now();
+
+private:
+	uint64_t toTick(uint64_t ms) const {
+		return ms / tickMs;
+	}
+
+	uint32_t tickMs;
+	uint64_t currentTick;   // all ticks up to here are expired
+	size_t count;           // scheduled timers
+	SRscpTimer slots[RSCP_TIMER_SLOTS];    // list heads
+};
+
+#endif /* RSCPTIMERWHEEL_H_ */
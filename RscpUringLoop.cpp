@@ -0,0 +1,517 @@
+//============================================================================
+// Name        : RscpUringLoop.cpp
+// Description : Runs many RscpSessions in one thread with io_uring
+//============================================================================
+
+#define RLOG_COMPONENT RscpUring
+#include <rlog/rlog.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#include "RscpUringLoop.h"
+#include "SocketConnection.h"
+
+// submission entries; a connection has at most a read and a write (or its connect) and their cancels on the way
+#define RSCP_URING_ENTRIES 256
+// request frames are small, the send buffer of a connection takes all frames of a pipeline at once
+#define RSCP_URING_SEND_BUFFER 8192
+
+static int io_uring_setup(uint32_t entries, struct io_uring_params * params) {
+	return (int) syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int io_uring_enter(int fd, uint32_t toSubmit, uint32_t minComplete, uint32_t flags, const void * arg, size_t argSize) {
+	return (int) syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize);
+}
+
+static int io_uring_register(int fd, uint32_t opcode, const void * arg, uint32_t nrArgs) {
+	return (int) syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs);
+}
+
+RscpUringLoop::RscpUringLoop() :
+		ringFd(-1), failed(0), fixedBuffers(false), sqRing(MAP_FAILED), sqRingSize(0), cqRing(MAP_FAILED), cqRingSize(0), sqes(
+				(struct io_uring_sqe *) MAP_FAILED), sqesSize(0), sqHead(NULL), sqTail(NULL), sqMask(0), sqEntries(0), sqArray(NULL), cqHead(NULL), cqTail(
+				NULL), cqMask(0), cqes(NULL) {
+	if (!setup(RSCP_URING_ENTRIES) && (ringFd >= 0)) {
+		::close(ringFd);
+		ringFd = -1;
+	}
+}
+
+RscpUringLoop::~RscpUringLoop() {
+	// closing the ring first ends the operations that are still on the way
+	if (ringFd >= 0) {
+		::close(ringFd);
+	}
+	for (size_t i = 0; i < connections.size(); i++) {
+		if (connections[i]->fd >= 0) {
+			SocketClose(connections[i]->fd);
+		}
+		delete connections[i];
+	}
+	if (sqes != MAP_FAILED) {
+		munmap(sqes, sqesSize);
+	}
+	if ((cqRing != MAP_FAILED) && (cqRing != sqRing)) {
+		munmap(cqRing, cqRingSize);
+	}
+	if (sqRing != MAP_FAILED) {
+		munmap(sqRing, sqRingSize);
+	}
+}
+
+bool RscpUringLoop::setup(uint32_t entries) {
+	struct io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	ringFd = io_uring_setup(entries, &params);
+	if (ringFd < 0) {
+		return false;
+	}
+	// the timeout of the wait is passed to io_uring_enter()
+	if (!(params.features & IORING_FEAT_EXT_ARG)) {
+		return false;
+	}
+
+	sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+	cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	if (params.features & IORING_FEAT_SINGLE_MMAP) {
+		// both rings in one mapping
+		if (cqRingSize > sqRingSize) {
+			sqRingSize = cqRingSize;
+		}
+		cqRingSize = sqRingSize;
+	}
+	sqRing = mmap(NULL, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+	if (sqRing == MAP_FAILED) {
+		return false;
+	}
+	if (params.features & IORING_FEAT_SINGLE_MMAP) {
+		cqRing = sqRing;
+	} else {
+		cqRing = mmap(NULL, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+		if (cqRing == MAP_FAILED) {
+			return false;
+		}
+	}
+	sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	sqes = (struct io_uring_sqe *) mmap(NULL, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+	if (sqes == MAP_FAILED) {
+		return false;
+	}
+
+	uint8_t * sq = (uint8_t *) sqRing;
+	sqHead = (uint32_t *) (sq + params.sq_off.head);
+	sqTail = (uint32_t *) (sq + params.sq_off.tail);
+	sqMask = *(uint32_t *) (sq + params.sq_off.ring_mask);
+	sqEntries = *(uint32_t *) (sq + params.sq_off.ring_entries);
+	sqArray = (uint32_t *) (sq + params.sq_off.array);
+	uint8_t * cq = (uint8_t *) cqRing;
+	cqHead = (uint32_t *) (cq + params.cq_off.head);
+	cqTail = (uint32_t *) (cq + params.cq_off.tail);
+	cqMask = *(uint32_t *) (cq + params.cq_off.ring_mask);
+	cqes = (struct io_uring_cqe *) (cq + params.cq_off.cqes);
+	return true;
+}
+
+struct io_uring_sqe * RscpUringLoop::getSqe() {
+	uint32_t tail = *sqTail;
+	if (tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries) {
+		// the ring is full, hand the entries to the kernel
+		enter(0, -1);
+		if (tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries) {
+			return NULL;
+		}
+	}
+	struct io_uring_sqe * sqe = &sqes[tail & sqMask];
+	memset(sqe, 0, sizeof(*sqe));
+	sqArray[tail & sqMask] = tail & sqMask;
+	// the kernel sees the entry when the tail is moved, after it is filled
+	return sqe;
+}
+
+int RscpUringLoop::enter(uint32_t minComplete, int timeout) {
+	// all filled entries are published with the tail, see getSqe()
+	uint32_t toSubmit = *sqTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+	uint32_t flags = 0;
+	struct __kernel_timespec ts;
+	struct io_uring_getevents_arg arg;
+	memset(&arg, 0, sizeof(arg));
+	if (minComplete > 0) {
+		flags |= IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+		if (timeout >= 0) {
+			ts.tv_sec = timeout / 1000;
+			ts.tv_nsec = (timeout % 1000) * 1000000L;
+			arg.ts = (uint64_t) (uintptr_t) &ts;
+		}
+	}
+	for (;;) {
+		int iResult = io_uring_enter(ringFd, toSubmit, minComplete, flags, (flags & IORING_ENTER_EXT_ARG) ? &arg : NULL, sizeof(arg));
+		if ((iResult < 0) && (errno == EINTR)) {
+			continue;
+		}
+		// ETIME if the timeout expired before a completion
+		return iResult;
+	}
+}
+
+bool RscpUringLoop::add(RscpSession * session) {
+	SConnection * connection = new SConnection;
+	init(connection, session);
+	connection->fd = -1;
+	connection->registeredBuffer = NULL;
+	connection->registeredCapacity = 0;
+	connection->sendBuffer.resize(RSCP_URING_SEND_BUFFER);
+	connection->index = connections.size();
+	if (!open(connection) && !connection->waiting) {
+		delete connection;
+		return false;
+	}
+	connections.push_back(connection);
+	return connection->fd >= 0;
+}
+
+bool RscpUringLoop::open(SConnection * connection) {
+	RscpSession * session = connection->session;
+	connection->closing = false;
+	connection->reading = false;
+	connection->writing = false;
+	connection->connecting = false;
+	connection->pending = false;
+	connection->waiting = false;
+	connection->cancels = 0;
+	connection->sendPos = 0;
+	connection->sendLength = 0;
+	session->connecting();
+	connection->fd = (ringFd >= 0) ? SocketOpen(session->getIp(), session->getPort(), &connection->address) : -1;
+	if (connection->fd < 0) {
+		session->fail((ringFd >= 0) ? errno : ENOSYS);
+		if (session->getState() == RscpSession::eStateFailed) {
+			failed++;
+		}
+		ended(connection);
+		return false;
+	}
+	return true;
+}
+
+void RscpUringLoop::ended(SConnection * connection) {
+	if (waitForRetry(connection)) {
+		// the slot of the receive buffer stays with the connection
+		connection->closing = true;
+	}
+}
+
+void RscpUringLoop::registerBuffers() {
+	std::vector<struct iovec> iovecs(connections.size());
+	for (size_t i = 0; i < connections.size(); i++) {
+		uint32_t length;
+		connections[i]->session->getReceiveSpace(length);
+		uint8_t * buffer = connections[i]->session->getReceiveBuffer(length);
+		iovecs[i].iov_base = buffer;
+		iovecs[i].iov_len = length;
+		connections[i]->registeredBuffer = buffer;
+		connections[i]->registeredCapacity = length;
+	}
+	struct io_uring_rsrc_register reg;
+	memset(&reg, 0, sizeof(reg));
+	reg.nr = iovecs.size();
+	reg.data = (uint64_t) (uintptr_t) iovecs.data();
+	fixedBuffers = (iovecs.size() > 0) && (io_uring_register(ringFd, IORING_REGISTER_BUFFERS2, &reg, sizeof(reg)) == 0);
+	if (!fixedBuffers && (iovecs.size() > 0)) {
+		// e.g. RLIMIT_MEMLOCK too small for the pinned pages: read with plain recv
+		rWarning("io_uring: cannot register the receive buffers: %s, using recv\n", strerror(errno));
+	}
+}
+
+int RscpUringLoop::run() {
+	if (ringFd < 0) {
+		return -1;
+	}
+	registerBuffers();
+	uint64_t now = RscpTimerWheel::now();
+	for (size_t i = 0; i < connections.size(); i++) {
+		if (!connections[i]->waiting) {
+			wheel.schedule(&connections[i]->timer, now, timeoutMs);
+			submitConnect(connections[i]);
+		}
+	}
+
+	while (!connections.empty()) {
+		int iResult = enter(1, wheel.getTimeout(RscpTimerWheel::now()));
+		if ((iResult < 0) && (errno != ETIME) && (errno != EBUSY)) {
+			// the loop can not go on, all open sessions fail; the destructor closes the sockets
+			int error = errno;
+			for (size_t i = 0; i < connections.size(); i++) {
+				if (!connections[i]->closing || connections[i]->waiting) {
+					connections[i]->closing = true;
+					connections[i]->waiting = false;
+					connections[i]->session->abort(error);
+					failed++;
+				}
+			}
+			break;
+		}
+
+		// all completions of this round, the head is moved once at the end
+		uint32_t head = *cqHead;
+		uint32_t tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+		for (; head != tail; head++) {
+			complete(&cqes[head & cqMask]);
+		}
+		__atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+
+		expireTimers();
+		flush();
+
+		// the connections without any operation on the way can go
+		size_t kept = 0;
+		for (size_t i = 0; i < connections.size(); i++) {
+			if ((connections[i]->fd >= 0) || connections[i]->waiting) {
+				connections[kept++] = connections[i];
+			} else {
+				delete connections[i];
+			}
+		}
+		connections.resize(kept);
+	}
+	return failed;
+}
+
+void RscpUringLoop::submitConnect(SConnection * connection) {
+	struct io_uring_sqe * sqe = getSqe();
+	if (sqe == NULL) {
+		closeConnection(connection, EBUSY);
+		return;
+	}
+	sqe->opcode = IORING_OP_CONNECT;
+	sqe->fd = connection->fd;
+	sqe->addr = (uint64_t) (uintptr_t) &connection->address;
+	sqe->off = sizeof(connection->address);
+	sqe->user_data = (uint64_t) (uintptr_t) connection | eOpConnect;
+	__atomic_store_n(sqTail, *sqTail + 1, __ATOMIC_RELEASE);
+	connection->connecting = true;
+}
+
+void RscpUringLoop::submitRead(SConnection * connection) {
+	struct io_uring_sqe * sqe = getSqe();
+	if (sqe == NULL) {
+		closeConnection(connection, EBUSY);
+		return;
+	}
+	RscpSession * session = connection->session;
+	uint32_t length;
+	uint8_t * space = session->getReceiveSpace(length);
+	if (space == NULL) {
+		// the entry is not handed to the kernel, the next call of getSqe() uses it again
+		closeConnection(connection, session->getError());
+		return;
+	}
+	if (fixedBuffers) {
+		uint32_t capacity;
+		uint8_t * buffer = session->getReceiveBuffer(capacity);
+		if ((buffer != connection->registeredBuffer) || (capacity != connection->registeredCapacity)) {
+			// the session has grown its buffer, replace the registered one
+			struct iovec iov;
+			iov.iov_base = buffer;
+			iov.iov_len = capacity;
+			struct io_uring_rsrc_update2 update;
+			memset(&update, 0, sizeof(update));
+			update.offset = connection->index;
+			update.data = (uint64_t) (uintptr_t) &iov;
+			update.nr = 1;
+			int iResult = io_uring_register(ringFd, IORING_REGISTER_BUFFERS_UPDATE, &update, sizeof(update));
+			if (iResult == 1) {
+				connection->registeredBuffer = buffer;
+				connection->registeredCapacity = capacity;
+			} else {
+				// all connections read with plain recv from now on, so this is logged once
+				fixedBuffers = false;
+				rWarning("io_uring: cannot register the grown receive buffer of %s: %s, using recv\n", session->getName(),
+						strerror((iResult < 0) ? errno : EIO));
+			}
+		}
+	}
+	if (fixedBuffers) {
+		// the kernel copies straight into the pinned receive buffer of the session
+		sqe->opcode = IORING_OP_READ_FIXED;
+		sqe->buf_index = connection->index;
+	} else {
+		sqe->opcode = IORING_OP_RECV;
+	}
+	sqe->fd = connection->fd;
+	sqe->addr = (uint64_t) (uintptr_t) space;
+	sqe->len = length;
+	sqe->user_data = (uint64_t) (uintptr_t) connection | eOpRead;
+	__atomic_store_n(sqTail, *sqTail + 1, __ATOMIC_RELEASE);
+	connection->reading = true;
+}
+
+void RscpUringLoop::submitWrite(SConnection * connection) {
+	if (connection->writing || connection->closing) {
+		return;
+	}
+	if (connection->sendPos == connection->sendLength) {
+		// take over the next encrypted bytes of the session
+		uint32_t length;
+		const uint8_t * data = connection->session->getSendData(length);
+		if (data == NULL) {
+			return;
+		}
+		if (length > connection->sendBuffer.size()) {
+			length = connection->sendBuffer.size();
+		}
+		memcpy(&connection->sendBuffer[0], data, length);
+		connection->session->sent(length);
+		connection->sendPos = 0;
+		connection->sendLength = length;
+	}
+	struct io_uring_sqe * sqe = getSqe();
+	if (sqe == NULL) {
+		closeConnection(connection, EBUSY);
+		return;
+	}
+	sqe->opcode = IORING_OP_SEND;
+	sqe->fd = connection->fd;
+	sqe->addr = (uint64_t) (uintptr_t) (&connection->sendBuffer[0] + connection->sendPos);
+	sqe->len = connection->sendLength - connection->sendPos;
+	sqe->msg_flags = MSG_NOSIGNAL;
+	sqe->user_data = (uint64_t) (uintptr_t) connection | eOpWrite;
+	__atomic_store_n(sqTail, *sqTail + 1, __ATOMIC_RELEASE);
+	connection->writing = true;
+}
+
+void RscpUringLoop::submitCancel(SConnection * connection, eOperation op) {
+	struct io_uring_sqe * sqe = getSqe();
+	if (sqe == NULL) {
+		// can not happen after getSqe() submitted the full ring; the operation ends with the socket then
+		shutdown(connection->fd, SHUT_RDWR);
+		return;
+	}
+	sqe->opcode = IORING_OP_ASYNC_CANCEL;
+	sqe->addr = (uint64_t) (uintptr_t) connection | op;
+	sqe->user_data = (uint64_t) (uintptr_t) connection | eOpCancel;
+	__atomic_store_n(sqTail, *sqTail + 1, __ATOMIC_RELEASE);
+	connection->cancels++;
+}
+
+void RscpUringLoop::complete(const struct io_uring_cqe * cqe) {
+	SConnection * connection = (SConnection *) (uintptr_t) (cqe->user_data & ~(uint64_t) eOpMask);
+	eOperation op = (eOperation) (cqe->user_data & eOpMask);
+	RscpSession * session = connection->session;
+	switch (op) {
+	case eOpConnect:
+		connection->connecting = false;
+		if (connection->closing) {
+			break;
+		}
+		if (cqe->res < 0) {
+			closeConnection(connection, -cqe->res);
+			break;
+		}
+		session->connected();
+		wheel.schedule(&connection->timer, RscpTimerWheel::now(), timeoutMs);
+		queueFrames(connection);
+		submitRead(connection);
+		break;
+	case eOpRead:
+		connection->reading = false;
+		if (connection->closing) {
+			break;
+		}
+		if ((cqe->res == -EINTR) || (cqe->res == -EAGAIN)) {
+			submitRead(connection);
+			break;
+		}
+		if (cqe->res < 0) {
+			closeConnection(connection, -cqe->res);
+			break;
+		}
+		if (cqe->res == 0) {
+			// connection was closed by peer, on startup e.g. a wrong AES password
+			closeConnection(connection, ECONNRESET);
+			break;
+		}
+		wheel.schedule(&connection->timer, RscpTimerWheel::now(), timeoutMs);
+		if (!session->received(cqe->res)) {
+			closeConnection(connection, session->getError());
+			break;
+		}
+		queueFrames(connection);
+		submitRead(connection);
+		break;
+	case eOpWrite:
+		connection->writing = false;
+		if (connection->closing) {
+			break;
+		}
+		if ((cqe->res < 0) && (cqe->res != -EINTR) && (cqe->res != -EAGAIN)) {
+			closeConnection(connection, -cqe->res);
+			break;
+		}
+		if (cqe->res > 0) {
+			connection->sendPos += cqe->res;
+		}
+		submitWrite(connection);
+		break;
+	default:
+		connection->cancels--;
+		break;
+	}
+	if (connection->closing) {
+		release(connection);
+	}
+}
+
+bool RscpUringLoop::isOpen(const SSessionConnection * connection) const {
+	return !((const SConnection *) connection)->closing;
+}
+
+void RscpUringLoop::sendFrames(SSessionConnection * connection) {
+	submitWrite((SConnection *) connection);
+}
+
+void RscpUringLoop::reconnect(SSessionConnection * sessionConnection) {
+	SConnection * connection = (SConnection *) sessionConnection;
+	if (open(connection)) {
+		wheel.schedule(&connection->timer, RscpTimerWheel::now(), timeoutMs);
+		submitConnect(connection);
+	}
+}
+
+void RscpUringLoop::closeConnection(SSessionConnection * sessionConnection, int error) {
+	SConnection * connection = (SConnection *) sessionConnection;
+	if (connection->closing) {
+		return;
+	}
+	connection->closing = true;
+	wheel.cancel(&connection->timer);
+	connection->session->fail(error);
+	if (connection->session->getState() == RscpSession::eStateFailed) {
+		failed++;
+	}
+	// the buffers stay until the kernel is done with them
+	if (connection->connecting) {
+		submitCancel(connection, eOpConnect);
+	}
+	if (connection->reading) {
+		submitCancel(connection, eOpRead);
+	}
+	if (connection->writing) {
+		submitCancel(connection, eOpWrite);
+	}
+	release(connection);
+}
+
+void RscpUringLoop::release(SConnection * connection) {
+	if ((connection->fd < 0) || connection->connecting || connection->reading || connection->writing || (connection->cancels > 0)) {
+		return;
+	}
+	SocketClose(connection->fd);
+	connection->fd = -1;
+	ended(connection);
+}
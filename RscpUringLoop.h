@@ -0,0 +1,123 @@
+//============================================================================
+// Name        : RscpUringLoop.h
+// Description : Runs many RscpSessions in one thread with io_uring, the
+//             : alternative to RscpEventLoop. Connect, receive and send
+//             : of all sessions are submitted and completed with one
+//             : system call per round. The received cipher text is read
+//             : straight into the registered receive buffer of the
+//             : session. Encryption and timers see RscpSessionLoop. Uses the
+//             : system calls directly, liburing is not needed.
+//============================================================================
+
+#ifndef RSCPURINGLOOP_H_
+#define RSCPURINGLOOP_H_
+
+#include <vector>
+#include <netinet/in.h>
+#include "RscpSessionLoop.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+class RscpUringLoop : public RscpSessionLoop {
+public:
+	RscpUringLoop();
+	~RscpUringLoop();
+    /*
+     * \brief Whether the kernel supports io_uring with everything needed (Linux 5.11 or later).
+     *        If not, RscpEventLoop has to be used.
+     */
+	bool isAvailable() const {
+		return ringFd >= 0;
+	}
+    /*
+     * \brief Queue \var session to connect when run() starts. The session must stay valid until run() returns.
+     *        A session in RscpSession::eStateBackoff after a failure is connected again after its retry delay.
+     * @return - false if no socket could be created, the session has failed or waits for a retry then
+     */
+	bool add(RscpSession * session);
+    /*
+     * \brief Run until all added sessions are finished. A failing session does not stop the others.
+     * @return - Number of failed sessions, -1 if io_uring is not available
+     */
+	int run();
+
+private:
+	// operation of a submission, in the low bits of its user_data
+	enum eOperation {
+		eOpConnect,
+		eOpRead,
+		eOpWrite,
+		eOpCancel,
+		eOpMask = 3
+	};
+
+	struct SConnection : public SSessionConnection {
+		int fd;
+		struct sockaddr_in address;  // read by the kernel while the connect is on the way
+		bool closing;               // session ended, waiting for the operations on the way
+		bool reading;
+		bool writing;
+		bool connecting;
+		uint32_t cancels;           // cancel operations on the way
+		// registered receive buffer of the session, it is registered again when the session moves it
+		const uint8_t * registeredBuffer;
+		uint32_t registeredCapacity;
+		// cipher text handed to the kernel, the session may append frames to its own buffer meanwhile;
+		// sent with IORING_OP_SEND and MSG_NOSIGNAL, a write to a closed socket would raise SIGPIPE
+		std::vector<uint8_t> sendBuffer;
+		uint32_t sendPos;
+		uint32_t sendLength;
+		uint32_t index;             // slot of the receive buffer in the registered buffers
+	};
+
+	// start the session of \var connection again with a new socket, false if there is none
+	bool open(SConnection * connection);
+	// the socket of \var connection is closed: wait for a retry if the session does
+	void ended(SConnection * connection);
+	// set up the rings, false if io_uring is not available
+	bool setup(uint32_t entries);
+	// a free submission entry, submits the queued ones if the ring is full
+	struct io_uring_sqe * getSqe();
+	// submit the queued entries and wait for at least \var minComplete completions or \var timeout ms (-1 = no timeout)
+	int enter(uint32_t minComplete, int timeout);
+	// register the receive buffers of all connections, falls back to plain recv with a warning if not possible
+	void registerBuffers();
+	void submitConnect(SConnection * connection);
+	void submitRead(SConnection * connection);
+	void submitWrite(SConnection * connection);
+	void submitCancel(SConnection * connection, eOperation op);
+	void complete(const struct io_uring_cqe * cqe);
+	// close the socket when no operation is on the way any more, then wait for a retry if the session does
+	void release(SConnection * connection);
+
+	bool isOpen(const SSessionConnection * connection) const;
+	void sendFrames(SSessionConnection * connection);
+	void reconnect(SSessionConnection * connection);
+	// the operations on the way are cancelled
+	void closeConnection(SSessionConnection * connection, int error);
+
+	int ringFd;
+	std::vector<SConnection *> connections;
+	int failed;
+	bool fixedBuffers;
+
+	// the mapped rings
+	void * sqRing;
+	size_t sqRingSize;
+	void * cqRing;
+	size_t cqRingSize;
+	struct io_uring_sqe * sqes;
+	size_t sqesSize;
+	uint32_t * sqHead;
+	uint32_t * sqTail;
+	uint32_t sqMask;
+	uint32_t sqEntries;
+	uint32_t * sqArray;
+	uint32_t * cqHead;
+	uint32_t * cqTail;
+	uint32_t cqMask;
+	struct io_uring_cqe * cqes;
+};
+
+#endif /* RSCPURINGLOOP_H_ */
@@ -52,6 +52,8 @@ int usage(const char *errstr) {
 	cerr << "--aes aes-password       password for AES encryption (mandatory)" << endl;
 	cerr << "--AES env-variable       password for AES encryption is in ENV variable (mandatory)" << endl;
 	cerr << "--ip  IP-addr			  IP address of S10 solar power station" << endl;
+	cerr << "--fleet file             read all S10s of file at the same time instead of -u -p -a -i -s;" << endl;
+	cerr << "                         one line per S10: ip port user password aes-password" << endl;
 	cerr << "Options:" << endl;
 	cerr << "--version      version string" << endl;
 	cerr << "--help         this message" << endl;
@@ -62,6 +64,15 @@ int usage(const char *errstr) {
 	cerr << "--month -+num  month; current month if not present" << endl;
 	cerr << "--day +-num    day; current day if not present" << endl;
 	cerr << "--service num  services port number (default: 5033)" << endl;
+	cerr << "--count num    report num consecutive days, months or years over one connection (default: 1)" << endl;
+	cerr << "--uring        use io_uring for the connections (Linux 5.11 or later; default: epoll)" << endl;
+	cerr << "--retry num    reconnect num times after a failed connection; only unanswered reports are" << endl;
+	cerr << "               requested again (default: 3; 0 = no retry and no breaker)" << endl;
+	cerr << "--backoff ms[,max]       first retry after ms milliseconds, doubled up to max +-25% (default: 1000,30000)" << endl;
+	cerr << "--breaker num[,seconds]  pause a S10 for seconds after num failures within seconds (default: 3,30; 0 = off);" << endl;
+	cerr << "                         every failure counts, the retries start again after each response, so num" << endl;
+	cerr << "                         greater than --retry only pauses a S10 that fails between its responses;" << endl;
+	cerr << "                         the pause is up to 50% longer at random" << endl;
 
 	return 1;
 }
@@ -92,10 +103,17 @@ int main(int argc, char *argv[]) {
 	// S10 ip addr
 	char * ip = 0;		// ip
 	int service = 5033; // service port number of RSCP server S10
+	char * fleet = 0;	// file with many S10s
 
 	// report type
 	int report_type = 0; // 1=year; 2=month, 4=day; 0=current day
 	bool brief = false;	 // brief means only sum container to report
+	int count = 1;		 // number of consecutive reports
+
+	// retry after a failed connection
+	int retries = 3;
+	int backoff = 1000, backoff_max = 30000;	// ms
+	int breaker = 3, breaker_time = 30;		// failures, seconds
 
 	// option struct
 	const struct option longopts[] = { { "version", no_argument, 0, 'v' }, { "year", required_argument, 0, 'y' }, { "month", required_argument, 0, 'm' }, { "day",
@@ -103,7 +121,8 @@ int main(int argc, char *argv[]) {
 	required_argument, 0, 'u' }, { "password", required_argument, 0, 'p' }, { "Password",
 	required_argument, 0, 'P' }, { "aes", required_argument, 0, 'a' }, { "AES", required_argument, 0, 'A' }, { "Debug", required_argument, 0, 'D' },
 			{ "help", no_argument, 0, 'h' }, { "utc", no_argument, 0, 'U' }, { "ip", required_argument, 0, 'i' }, { "service", required_argument, 0, 's' }, { "brief", no_argument,
-					0, 'b' }, };
+					0, 'b' }, { "count", required_argument, 0, 'c' }, { "fleet", required_argument, 0, 'f' }, { "uring", no_argument, 0, 'r' }, { "retry",
+			required_argument, 0, 'R' }, { "backoff", required_argument, 0, 'B' }, { "breaker", required_argument, 0, 'C' }, };
 
 	// process arguments
 	int index;
@@ -113,7 +132,7 @@ int main(int argc, char *argv[]) {
 	// turn off getopt error message
 	// opterr=1;
 	while (iarg != -1) {
-		iarg = getopt_long(argc, argv, "vhUy:m:d:u:p:P:d:D:A:a:i:s:b", longopts, &index);
+		iarg = getopt_long(argc, argv, "vhUy:m:d:u:p:P:d:D:A:a:i:s:bc:f:rR:B:C:", longopts, &index);
 		switch (iarg) {
 		case 'h':
 			return usage("");
@@ -128,6 +147,12 @@ int main(int argc, char *argv[]) {
 		case 'b':
 			brief = true;
 			break;
+		case 'c':
+			count = atoi(optarg);
+			if (count < 1 || count > 10000) {
+				return usage("ERROR: invalid count");
+			}
+			break;
 		case 'y':
 			y = atol(optarg);
 			if (y < 2012 || y > 2032) {
@@ -195,6 +220,29 @@ int main(int argc, char *argv[]) {
 		case 'i':
 			ip = optarg;
 			break;
+		case 'f':
+			fleet = optarg;
+			break;
+		case 'r':
+			extern void RscpReader_Uring(bool on);
+			RscpReader_Uring(true);
+			break;
+		case 'R':
+			retries = atoi(optarg);
+			if (retries < 0 || retries > 1000) {
+				return usage("ERROR: invalid number of retries");
+			}
+			break;
+		case 'B':
+			if (sscanf(optarg, "%d,%d", &backoff, &backoff_max) < 1 || backoff < 0 || backoff > 3600000 || backoff_max < 0 || backoff_max > 3600000) {
+				return usage("ERROR: invalid backoff");
+			}
+			break;
+		case 'C':
+			if (sscanf(optarg, "%d,%d", &breaker, &breaker_time) < 1 || breaker < 0 || breaker_time < 1 || breaker_time > 86400) {
+				return usage("ERROR: invalid breaker");
+			}
+			break;
 		case 'D':
 			debug = atoi(optarg);
 			stdLog.subscribeTo(GetGlobalChannel("info"));
@@ -205,16 +253,29 @@ int main(int argc, char *argv[]) {
 		}
 	}
 
-	// check user (mandatory)
-	if (!user || !password || !aes) {
-		return usage("ERROR: user name, password and aes key must be given");
-	}
-	if (!ip) {
-		return usage("ERROR: no S10 address given");
+	extern void RscpReader_Retry(int retries, int baseMs, int maxMs);
+	extern void RscpReader_Breaker(int failures, int seconds);
+	RscpReader_Retry(retries, backoff, backoff_max);
+	RscpReader_Breaker(breaker, breaker_time);
+
+	if (fleet) {
+		// address and credentials of each S10 are in the file
+		extern int RscpReader_Fleet(const char * file);
+		if (RscpReader_Fleet(fleet) <= 0) {
+			return usage("ERROR: no S10 in fleet file");
+		}
+	} else {
+		// check user (mandatory)
+		if (!user || !password || !aes) {
+			return usage("ERROR: user name, password and aes key must be given");
+		}
+		if (!ip) {
+			return usage("ERROR: no S10 address given");
+		}
+		rDebug("User: %s", user);
+		rDebug("Password: %s", password);
+		rDebug("AES pw: %s", aes);
 	}
-	rDebug("User: %s", user);
-	rDebug("Password: %s", password);
-	rDebug("AES pw: %s", aes);
 
 	// check time
 	l->tm_sec = l->tm_min = l->tm_hour = 0;
@@ -225,10 +286,10 @@ int main(int argc, char *argv[]) {
 		return usage("ERROR: report date is in the future");
 	}
 
-	extern int RscpReader_Day(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool brief);
-	extern int RscpReader_Month(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool brief);
-	extern int RscpReader_Year(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool brief);
-	int (*report_func)(const char *, const char *, const char *, const char *, int port, struct tm *, bool brief) = RscpReader_Day;
+	extern int RscpReader_Day(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool brief, int count);
+	extern int RscpReader_Month(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool brief, int count);
+	extern int RscpReader_Year(const char * user, const char *pw, const char *aes, const char * ip, int port, struct tm *l, bool brief, int count);
+	int (*report_func)(const char *, const char *, const char *, const char *, int port, struct tm *, bool brief, int count) = RscpReader_Day;
 
 	// check report span
 	if (report_type == 0) {
@@ -256,7 +317,11 @@ int main(int argc, char *argv[]) {
 		break;
 	}
 	rInfo("Report starts: %s", asctime(l));
-	rInfo("S10 addr: %s, Port: %d", ip, service);
-	return (*report_func)(user, password, aes, ip, service, l, brief);
+	if (fleet) {
+		rInfo("S10 fleet: %s", fleet);
+	} else {
+		rInfo("S10 addr: %s, Port: %d", ip, service);
+	}
+	return (*report_func)(user, password, aes, ip, service, l, brief, count);
 	return 0;
 }
@@ -155,6 +155,8 @@ sub read_file($) {
 			next;
 		}
 		my @line = split( /[;,]/, $1 );
+		# values the S10 did not send for an interval are nan
+		@line = map { /^-?nan$/i ? "NULL" : $_ } @line;
 		$line[0] = "FROM_UNIXTIME($line[0])";
 		my $values = join( ", ", @line );
 
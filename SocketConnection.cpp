@@ -16,20 +16,28 @@
  * A Microsoft Windows implementation is not supplied in this example.
  */
 
-int SocketConnect(const char *cpIpAddress, int iPort) {
+bool SocketAddress(const char *cpIpAddress, int iPort, struct sockaddr_in *server_addr) {
 
     unsigned char ucBuffer[sizeof(struct in6_addr)];
 
     if(inet_pton(AF_INET, cpIpAddress, ucBuffer) <= 0) {
-        printf("IP address %s cannot be converted.\n", cpIpAddress);
-        return -1;
+        return false;
     }
 
+    memset(server_addr, 0, sizeof(*server_addr));
+    server_addr->sin_family = AF_INET;
+    server_addr->sin_port = htons(iPort);
+    server_addr->sin_addr = *((struct in_addr *) ucBuffer);
+    return true;
+}
+
+int SocketConnect(const char *cpIpAddress, int iPort) {
+
     struct sockaddr_in server_addr;
-    memset(&server_addr, 0, sizeof(server_addr));
-    server_addr.sin_family = AF_INET;
-    server_addr.sin_port = htons(iPort);
-    server_addr.sin_addr = *((struct in_addr *) ucBuffer);
+    if(!SocketAddress(cpIpAddress, iPort, &server_addr)) {
+        printf("IP address %s cannot be converted.\n", cpIpAddress);
+        return -1;
+    }
 
     int iSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
     if(iSocket < 0) {
@@ -62,6 +70,61 @@ int SocketConnect(const char *cpIpAddress, int iPort) {
     return iSocket;
 }
 
+int SocketOpen(const char *cpIpAddress, int iPort, struct sockaddr_in *server_addr) {
+
+    if(!SocketAddress(cpIpAddress, iPort, server_addr)) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    int iSocket = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, IPPROTO_TCP);
+    if(iSocket < 0) {
+        return iSocket;
+    }
+
+    int enable = 1;
+    setsockopt(iSocket, IPPROTO_TCP, TCP_NODELAY, (char *) &enable, sizeof(enable));
+
+    return iSocket;
+}
+
+int SocketConnectNonBlocking(const char *cpIpAddress, int iPort) {
+
+    struct sockaddr_in server_addr;
+    if(!SocketAddress(cpIpAddress, iPort, &server_addr)) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    int iSocket = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_TCP);
+    if(iSocket < 0) {
+        return iSocket;
+    }
+
+    int enable = 1;
+    setsockopt(iSocket, IPPROTO_TCP, TCP_NODELAY, (char *) &enable, sizeof(enable));
+
+    // the connection is usually still in progress, it is ready when the socket becomes writable
+    if(connect(iSocket, (struct sockaddr *) &server_addr, sizeof(server_addr)) < 0 && errno != EINPROGRESS) {
+        int iError = errno;
+        close(iSocket);
+        errno = iError;
+        return -1;
+    }
+
+    return iSocket;
+}
+
+int SocketConnectResult(int iSocket) {
+
+    int iError = 0;
+    socklen_t len = sizeof(iError);
+    if(getsockopt(iSocket, SOL_SOCKET, SO_ERROR, &iError, &len) < 0) {
+        return errno;
+    }
+    return iError;
+}
+
 void SocketClose(int iSocket)
 {
     // sanity check
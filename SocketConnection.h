@@ -1,6 +1,8 @@
 #ifndef __SOCKET_CONNECTION_H_
 #define __SOCKET_CONNECTION_H_
 
+#include <netinet/in.h>
+
 /*
  * This is a very simple example client socket connection.
  * Plain functions are used in this example instead of a well formed C++ class.
@@ -8,7 +10,23 @@
  * and the demonstration of the RSCP protocol which is not limited to TCP or Ethernet at all.
  */
 
+/*
+ * Server address of an IPv4 address string, false if the string cannot be converted.
+ */
+bool SocketAddress(const char *cpIpAddress, int iPort, struct sockaddr_in *server_addr);
 int SocketConnect(const char *cpIpAddress, int iPort);
+/*
+ * Non blocking socket for an event loop: returns at once, the connection is ready when the socket becomes
+ * writable and SocketConnectResult() returns 0 (else the errno of the failed connect). -1 and errno on error,
+ * EINVAL if the address cannot be converted.
+ */
+int SocketConnectNonBlocking(const char *cpIpAddress, int iPort);
+int SocketConnectResult(int iSocket);
+/*
+ * Socket (TCP_NODELAY) and server address for a connect done elsewhere, e.g. by io_uring. -1 and errno on error,
+ * EINVAL if the address cannot be converted.
+ */
+int SocketOpen(const char *cpIpAddress, int iPort, struct sockaddr_in *server_addr);
 void SocketClose(int iSocket);
 int SocketSendData(int iSocket, const unsigned char * ucBuffer, int iLength);
 int SocketRecvData(int iSocket, unsigned char * ucBuffer, int iLength);
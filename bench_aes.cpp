@@ -0,0 +1,318 @@
+//============================================================================
+// Name        : bench_aes.cpp
+// Description : Known answer tests, backend cross checks and throughput of
+//             : the AES class for all key and block sizes.
+//             : Build with "make bench_aes", run "./bench_aes [MB per test]"
+//             : The exit code is 1 if any check fails.
+//============================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <chrono>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "AES.h"
+
+using namespace std;
+
+static const char * backendNames[] = {"TABLE", "AESNI", "BITSLICE"};
+static const AES::Backend backends[] = {AES::TABLE, AES::AESNI, AES::BITSLICE};
+#define NUM_BACKENDS (int)(sizeof(backends) / sizeof(backends[0]))
+
+static int failures = 0;
+
+static uint64_t cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+static void hexToBytes(const char * hex, unsigned char * out) {
+	for (size_t i = 0; i < strlen(hex) / 2; i++) {
+		unsigned int v;
+		sscanf(hex + 2*i, "%2x", &v);
+		out[i] = (unsigned char)v;
+	}
+}
+
+// simple deterministic byte generator, the data only has to differ between the tests
+static uint32_t randomState = 0x12345678;
+static void fillRandom(unsigned char * data, size_t length) {
+	for (size_t i = 0; i < length; i++) {
+		randomState = randomState * 1103515245 + 12345;
+		data[i] = (unsigned char)(randomState >> 16);
+	}
+}
+
+struct KnownAnswer {
+	int keyBits;
+	int blockBits;
+	const char * key;
+	const char * plain;
+	const char * cipher;
+};
+
+// FIPS-197 appendix C and the Rijndael values with key = 00 01 02 .. and
+// plain text = 00 01 02 .. for all key and block sizes
+static const KnownAnswer knownAnswers[] = {
+	{128, 128, "000102030405060708090a0b0c0d0e0f", "00112233445566778899aabbccddeeff", "69c4e0d86a7b0430d8cdb78070b4c55a"},
+	{192, 128, "000102030405060708090a0b0c0d0e0f1011121314151617", "00112233445566778899aabbccddeeff", "dda97ca4864cdfe06eaf70a0ec0d7191"},
+	{256, 128, "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f", "00112233445566778899aabbccddeeff", "8ea2b7ca516745bfeafc49904b496089"},
+	{128, 128, "000102030405060708090a0b0c0d0e0f", "000102030405060708090a0b0c0d0e0f",
+			"0a940bb5416ef045f1c39458c653ea5a"},
+	{128, 192, "000102030405060708090a0b0c0d0e0f", "000102030405060708090a0b0c0d0e0f1011121314151617",
+			"54030626e366bba5827f46be060b53c75668fc25fb1a6074"},
+	{128, 256, "000102030405060708090a0b0c0d0e0f", "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+			"21c89c4a7ae37f185597362e5d20485f6144afed71bd4a798688662e6cde7dc4"},
+	{192, 128, "000102030405060708090a0b0c0d0e0f1011121314151617", "000102030405060708090a0b0c0d0e0f",
+			"0060bffe46834bb8da5cf9a61ff220ae"},
+	{192, 192, "000102030405060708090a0b0c0d0e0f1011121314151617", "000102030405060708090a0b0c0d0e0f1011121314151617",
+			"7a5a73c8fbdbb2aa6866cc951b3e059a631cfefc09c424cf"},
+	{192, 256, "000102030405060708090a0b0c0d0e0f1011121314151617", "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+			"d4cc0b070ebebd98ffa1c28e40bffa5db8bdb8fb5bfb6ccf23af2c1608967acc"},
+	{256, 128, "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f", "000102030405060708090a0b0c0d0e0f",
+			"5a6e045708fb7196f02e553d02c3a692"},
+	{256, 192, "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f", "000102030405060708090a0b0c0d0e0f1011121314151617",
+			"b5e5bb698a33a80e4daed256760f1a5f08cc6f181e67b5bc"},
+	{256, 256, "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f", "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+			"623d2bd4ca3796dc3d02ecf2f37fb637fd3da58509cebb67ab9265b04db51e7d"},
+};
+
+static void checkKnownAnswers(AES::Backend backend) {
+	for (size_t i = 0; i < sizeof(knownAnswers) / sizeof(knownAnswers[0]); i++) {
+		const KnownAnswer & kat = knownAnswers[i];
+		unsigned char key[32], plain[32], cipher[32], result[32];
+		hexToBytes(kat.key, key);
+		hexToBytes(kat.plain, plain);
+		hexToBytes(kat.cipher, cipher);
+		const size_t blockSize = kat.blockBits / 8;
+
+		AES aes;
+		aes.SetBackend(backend);
+		aes.SetParameters(kat.keyBits, kat.blockBits);
+		aes.StartEncryption(key);
+		aes.EncryptBlock(plain, result);
+		bool ok = (memcmp(result, cipher, blockSize) == 0);
+		aes.Encrypt(plain, result, 1, AES::ECB);
+		ok = ok && (memcmp(result, cipher, blockSize) == 0);
+
+		aes.StartDecryption(key);
+		aes.DecryptBlock(cipher, result);
+		ok = ok && (memcmp(result, plain, blockSize) == 0);
+		aes.Decrypt(cipher, result, 1, AES::ECB);
+		ok = ok && (memcmp(result, plain, blockSize) == 0);
+
+		if (!ok) {
+			printf("KAT FAILED: backend %s key %d block %d\n", backendNames[backend], kat.keyBits, kat.blockBits);
+			failures++;
+		}
+	}
+}
+
+// compare all modes of a backend with the table implementation, also in place
+static void crossCheck(AES::Backend backend) {
+	for (int keyBits = 128; keyBits <= 256; keyBits += 64) {
+		for (int blockBits = 128; blockBits <= 256; blockBits += 64) {
+			for (uint32_t numBlocks = 1; numBlocks <= 33; numBlocks += 4) {
+				const size_t length = numBlocks * blockBits / 8;
+				unsigned char key[32], iv[32];
+				vector<unsigned char> plain(length), expected(length), result(length);
+				fillRandom(key, sizeof(key));
+				fillRandom(iv, sizeof(iv));
+				fillRandom(&plain[0], length);
+
+				AES reference, aes;
+				reference.SetBackend(AES::TABLE);
+				aes.SetBackend(backend);
+				reference.SetParameters(keyBits, blockBits);
+				aes.SetParameters(keyBits, blockBits);
+				bool ok = true;
+
+				for (int m = 0; m < 2; m++) {
+					const AES::BlockMode mode = m ? AES::CBC : AES::ECB;
+					reference.StartEncryption(key);
+					aes.StartEncryption(key);
+					reference.SetIV(iv, sizeof(iv));
+					aes.SetIV(iv, sizeof(iv));
+					reference.Encrypt(&plain[0], &expected[0], numBlocks, mode);
+					result = plain;
+					aes.Encrypt(&result[0], &result[0], numBlocks, mode);
+					ok = ok && (result == expected);
+
+					aes.StartDecryption(key);
+					aes.SetIV(iv, sizeof(iv));
+					aes.Decrypt(&result[0], &result[0], numBlocks, mode);
+					ok = ok && (result == plain);
+				}
+				if (!ok) {
+					printf("CROSS CHECK FAILED: backend %s key %d block %d blocks %u\n",
+							backendNames[backend], keyBits, blockBits, numBlocks);
+					failures++;
+				}
+			}
+		}
+	}
+}
+
+// AES::EncryptStreams against Encrypt of every single stream, different stream lengths
+static void crossCheckStreams(AES::Backend backend) {
+	const uint32_t numStreams = 19;
+	vector<AES> aes(numStreams);
+	vector< vector<unsigned char> > plain(numStreams), expected(numStreams), result(numStreams);
+	AES * streams[numStreams];
+	const unsigned char * datain[numStreams];
+	unsigned char * dataout[numStreams];
+	uint32_t numBlocks[numStreams];
+
+	for (uint32_t s = 0; s < numStreams; s++) {
+		unsigned char key[32], iv[32];
+		fillRandom(key, sizeof(key));
+		fillRandom(iv, sizeof(iv));
+		numBlocks[s] = s % 6;
+		plain[s].resize(32 * numBlocks[s] + 1);
+		fillRandom(&plain[s][0], plain[s].size());
+		expected[s] = result[s] = plain[s];
+
+		AES reference;
+		reference.SetBackend(AES::TABLE);
+		reference.SetParameters(256, 256);
+		reference.StartEncryption(key);
+		reference.SetIV(iv, sizeof(iv));
+		reference.Encrypt(&plain[s][0], &expected[s][0], numBlocks[s], AES::CBC);
+
+		aes[s].SetBackend(backend);
+		aes[s].SetParameters(256, 256);
+		aes[s].StartEncryption(key);
+		aes[s].SetIV(iv, sizeof(iv));
+		streams[s] = &aes[s];
+		datain[s] = &plain[s][0];
+		dataout[s] = &result[s][0];
+	}
+	AES::EncryptStreams(streams, datain, dataout, numBlocks, numStreams);
+	for (uint32_t s = 0; s < numStreams; s++) {
+		if (result[s] != expected[s]) {
+			printf("STREAM CROSS CHECK FAILED: backend %s stream %u\n", backendNames[backend], s);
+			failures++;
+		}
+	}
+}
+
+// 64 connections with one small frame each, like one poll of a fleet of S10s
+static void benchmarkStreams(AES::Backend backend, size_t megabytes) {
+	const uint32_t numStreams = 64;
+	const uint32_t blocksPerStream = 4;
+	vector<AES> aes(numStreams);
+	vector<unsigned char> data(numStreams * blocksPerStream * 32);
+	AES * streams[numStreams];
+	const unsigned char * datain[numStreams];
+	unsigned char * dataout[numStreams];
+	uint32_t numBlocks[numStreams];
+	fillRandom(&data[0], data.size());
+
+	for (uint32_t s = 0; s < numStreams; s++) {
+		unsigned char key[32];
+		fillRandom(key, sizeof(key));
+		aes[s].SetBackend(backend);
+		aes[s].SetParameters(256, 256);
+		aes[s].StartEncryption(key);
+		streams[s] = &aes[s];
+		datain[s] = dataout[s] = &data[s * blocksPerStream * 32];
+		numBlocks[s] = blocksPerStream;
+	}
+	const size_t rounds = megabytes * (1 << 20) / data.size();
+	for (int batch = 0; batch < 2; batch++) {
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		const uint64_t startCycles = cycles();
+		for (size_t i = 0; i < rounds; i++) {
+			if (batch) {
+				AES::EncryptStreams(streams, datain, dataout, numBlocks, numStreams);
+			} else {
+				for (uint32_t s = 0; s < numStreams; s++)
+					aes[s].Encrypt(datain[s], dataout[s], numBlocks[s], AES::CBC);
+			}
+		}
+		const uint64_t usedCycles = cycles() - startCycles;
+		const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		const double bytes = (double)rounds * data.size();
+		printf("%-8s %u streams CBC encrypt %-13s %9.1f MB/s %7.2f cycles/byte\n", backendNames[backend], numStreams,
+				batch ? "EncryptStreams" : "one by one", bytes / seconds / 1e6, usedCycles / bytes);
+	}
+}
+
+static void benchmark(AES::Backend backend, size_t megabytes) {
+	const size_t length = 1 << 20;
+	vector<unsigned char> data(length);
+	unsigned char key[32], iv[32];
+	fillRandom(&data[0], length);
+	fillRandom(key, sizeof(key));
+	fillRandom(iv, sizeof(iv));
+
+	for (int keyBits = 128; keyBits <= 256; keyBits += 64) {
+		for (int blockBits = 128; blockBits <= 256; blockBits += 64) {
+			const uint32_t blockSize = blockBits / 8;
+			const uint32_t numBlocks = length / blockSize;
+			for (int m = 0; m < 4; m++) {
+				const AES::BlockMode mode = (m & 1) ? AES::CBC : AES::ECB;
+				const bool decrypt = (m & 2) != 0;
+				AES aes;
+				aes.SetBackend(backend);
+				aes.SetParameters(keyBits, blockBits);
+				if (decrypt)
+					aes.StartDecryption(key);
+				else
+					aes.StartEncryption(key);
+
+				chrono::steady_clock::time_point start = chrono::steady_clock::now();
+				const uint64_t startCycles = cycles();
+				for (size_t i = 0; i < megabytes; i++) {
+					aes.SetIV(iv, sizeof(iv));
+					if (decrypt)
+						aes.Decrypt(&data[0], &data[0], numBlocks, mode);
+					else
+						aes.Encrypt(&data[0], &data[0], numBlocks, mode);
+				}
+				const uint64_t usedCycles = cycles() - startCycles;
+				const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+				const double bytes = (double)megabytes * numBlocks * blockSize;
+
+				printf("%-8s key %3d block %3d %s %s %9.1f MB/s %7.2f cycles/byte\n",
+						backendNames[backend], keyBits, blockBits, (mode == AES::CBC) ? "CBC" : "ECB",
+						decrypt ? "decrypt" : "encrypt", bytes / seconds / 1e6, usedCycles / bytes);
+			}
+		}
+	}
+}
+
+int main(int argc, char *argv[]) {
+	size_t megabytes = 16;
+	if (argc > 1)
+		megabytes = atoi(argv[1]);
+	if (megabytes == 0)
+		megabytes = 1;
+
+	for (int b = 0; b < NUM_BACKENDS; b++) {
+		if (!AES::BackendSupported(backends[b])) {
+			printf("%-8s not supported by this CPU\n", backendNames[b]);
+			continue;
+		}
+		checkKnownAnswers(backends[b]);
+		if (backends[b] != AES::TABLE)
+			crossCheck(backends[b]);
+		crossCheckStreams(backends[b]);
+	}
+	printf("known answer tests and cross checks: %s\n", failures ? "FAILED" : "ok");
+
+	for (int b = 0; b < NUM_BACKENDS; b++) {
+		if (AES::BackendSupported(backends[b])) {
+			benchmark(backends[b], megabytes);
+			benchmarkStreams(backends[b], megabytes);
+		}
+	}
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,314 @@
+//============================================================================
+// Name        : bench_rscp.cpp
+// Description : Throughput of the RSCP parsers and frame builders in frames/s
+//             : and MB/s on history responses of a day, a month, a year and
+//             : a frame near the size limit, and on recorded frames.
+//             : Build with "make bench_rscp", run
+//             : "./bench_rscp [ms per test] [frame file ...]"; a frame file
+//             : holds one decrypted frame as received from the S10.
+//============================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "RscpProtocol.h"
+#include "RscpArena.h"
+#include "RscpCRC32.h"
+#include "RscpContainer.h"
+#include "RscpFrameParser.h"
+#include "RscpFrameWriter.h"
+#include "RscpHistory.h"
+#include "RscpTags.h"
+
+using namespace std;
+
+struct BenchFrame {
+	string name;
+	vector<uint8_t> data;
+	uint32_t intervals;     // value containers of a synthetic frame, 0 for a recorded one
+};
+
+static uint32_t milliseconds = 200;
+// results go here so the compiler cannot drop the work
+static volatile uint64_t sink;
+
+// the fields the S10 sends for every interval of a history response
+static const SRscpTag historyTags[] = {TAG_DB_GRAPH_INDEX, TAG_DB_BAT_POWER_IN, TAG_DB_BAT_POWER_OUT,
+		TAG_DB_DC_POWER, TAG_DB_GRID_POWER_IN, TAG_DB_GRID_POWER_OUT, TAG_DB_CONSUMPTION,
+		TAG_DB_PM_0_POWER, TAG_DB_PM_1_POWER, TAG_DB_BAT_CHARGE_LEVEL, TAG_DB_BAT_CYCLE_COUNT,
+		TAG_DB_CONSUMED_PRODUCTION, TAG_DB_AUTARKY};
+#define NUM_HISTORY_TAGS (sizeof(historyTags) / sizeof(historyTags[0]))
+
+// history response with RscpFrameWriter: one value container per interval and the sum container
+static void writeHistory(RscpProtocol & protocol, vector<uint8_t> & buffer, uint32_t intervals) {
+	RscpFrameWriter writer(buffer);
+	writer.appendValue(TAG_EMS_POWER_PV, (int32_t) 4711);
+	writer.openContainer(TAG_DB_HISTORY_DATA_DAY);
+	for (uint32_t i = 0; i <= intervals; i++) {
+		writer.openContainer((i < intervals) ? TAG_DB_VALUE_CONTAINER : TAG_DB_SUM_CONTAINER);
+		for (size_t t = 0; t < NUM_HISTORY_TAGS; t++) {
+			writer.appendValue(historyTags[t], (float) (i * NUM_HISTORY_TAGS + t));
+		}
+		writer.closeContainer();
+	}
+	writer.closeContainer();
+	writer.finishFrame(protocol, true, 1);
+}
+
+// the same frame with the SRscpValue functions, like the requests were built before RscpFrameWriter
+static void appendHistory(RscpProtocol & protocol, SRscpFrameBuffer & frameBuffer, uint32_t intervals) {
+	SRscpValue rootValue;
+	protocol.createContainerValue(&rootValue, 0);
+	protocol.appendValue(&rootValue, TAG_EMS_POWER_PV, (int32_t) 4711);
+	SRscpValue history;
+	protocol.createContainerValue(&history, TAG_DB_HISTORY_DATA_DAY);
+	for (uint32_t i = 0; i <= intervals; i++) {
+		SRscpValue container;
+		protocol.createContainerValue(&container, (i < intervals) ? TAG_DB_VALUE_CONTAINER : TAG_DB_SUM_CONTAINER);
+		for (size_t t = 0; t < NUM_HISTORY_TAGS; t++) {
+			protocol.appendValue(&container, historyTags[t], (float) (i * NUM_HISTORY_TAGS + t));
+		}
+		protocol.appendValue(&history, container);
+		protocol.destroyValueData(container);
+	}
+	protocol.appendValue(&rootValue, history);
+	protocol.destroyValueData(history);
+	protocol.createFrameAsBuffer(&frameBuffer, rootValue.data, rootValue.length, true);
+	protocol.destroyValueData(rootValue);
+}
+
+// run \var test until the time is up and print frames/s and MB/s for frames of \var bytes
+template <typename Test>
+static void measure(const char * frameName, const char * testName, size_t bytes, Test test) {
+	typedef chrono::steady_clock clock;
+	clock::time_point start = clock::now();
+	clock::time_point end = start + chrono::milliseconds(milliseconds);
+	uint64_t frames = 0;
+	clock::time_point now;
+	do {
+		for (int i = 0; i < 16; i++) {
+			test();
+		}
+		frames += 16;
+		now = clock::now();
+	} while(now < end);
+	double seconds = chrono::duration<double>(now - start).count();
+	printf("%-8s %-28s %6zu bytes %12.0f frames/s %9.1f MB/s\n", frameName, testName, bytes,
+			frames / seconds, frames * bytes / seconds / 1e6);
+}
+
+// walk all values and containers in place
+static uint64_t walkRange(const uint8_t * data, uint32_t length) {
+	uint64_t sum = 0;
+	for (const SRscpValue & value : RscpContainerRange(data, length)) {
+		sum += value.tag;
+		if(value.dataType == RSCP::eTypeContainer) {
+			sum += walkRange(value.data, value.length);
+		}
+	}
+	return sum;
+}
+
+class SumVisitor : public RscpVisitor {
+public:
+	SumVisitor() : sum(0) {
+	}
+	void value(const SRscpValue & value) {
+		sum += value.tag;
+	}
+	uint64_t sum;
+};
+
+// walk all values with parseData(), the containers with getValueAsContainer()
+static uint64_t walkParsed(RscpProtocol & protocol, const vector<SRscpValue> & values, bool bCopyData) {
+	uint64_t sum = 0;
+	for (size_t i = 0; i < values.size(); i++) {
+		sum += values[i].tag;
+		if(values[i].dataType == RSCP::eTypeContainer) {
+			vector<SRscpValue> content = protocol.getValueAsContainer(&values[i], bCopyData);
+			sum += walkParsed(protocol, content, bCopyData);
+			if(bCopyData) {
+				protocol.destroyValueData(content);
+			}
+		}
+	}
+	return sum;
+}
+
+static void benchmarkParsers(const BenchFrame & frame) {
+	const uint8_t * data = frame.data.data();
+	const uint32_t length = frame.data.size();
+	const char * name = frame.name.c_str();
+	RscpProtocol protocol;
+	RscpArena arena;
+	RscpProtocol arenaProtocol(&arena);
+
+	// only reads the header
+	measure(name, "getFrameLength", sizeof(SRscpFrameHeader), [&]() {
+		sink += protocol.getFrameLength(data, length);
+	});
+	measure(name, "parseFrame copy + walk", length, [&]() {
+		SRscpFrame parsed;
+		sink += protocol.parseFrame(data, length, &parsed, true);
+		sink += walkParsed(protocol, parsed.data, true);
+		protocol.destroyFrameData(parsed);
+	});
+	measure(name, "parseFrame arena + walk", length, [&]() {
+		SRscpFrame parsed;
+		sink += arenaProtocol.parseFrame(data, length, &parsed, true);
+		sink += walkParsed(arenaProtocol, parsed.data, true);
+		arenaProtocol.destroyFrameData(parsed);
+		arena.reset();
+	});
+	measure(name, "parseFrame zero copy + walk", length, [&]() {
+		SRscpFrame parsed;
+		sink += protocol.parseFrame(data, length, &parsed, false);
+		sink += walkParsed(protocol, parsed.data, false);
+	});
+	// the tag data without the frame header and CRC, as the readers see it
+	const uint8_t * tagData = data + sizeof(SRscpFrameHeader);
+	const uint32_t tagLength = reinterpret_cast<const SRscpFrameHeader *>(data)->dataLength;
+	measure(name, "parseData zero copy + walk", length, [&]() {
+		vector<SRscpValue> values;
+		sink += protocol.parseData(tagData, tagLength, values, false);
+		sink += walkParsed(protocol, values, false);
+	});
+	measure(name, "visitData", length, [&]() {
+		SumVisitor visitor;
+		sink += protocol.visitData(tagData, tagLength, visitor);
+		sink += visitor.sum;
+	});
+	measure(name, "RscpContainerRange", length, [&]() {
+		sink += walkRange(tagData, tagLength);
+	});
+	for (const SRscpValue & value : RscpContainerRange(tagData, tagLength)) {
+		if(value.tag != TAG_DB_HISTORY_DATA_DAY) {
+			continue;
+		}
+		RscpHistory history;
+		measure(name, "RscpHistory decode", length, [&]() {
+			sink += history.decode(&value, 0, 900);
+		});
+	}
+	measure(name, "RscpFrameParser whole", length, [&]() {
+		static RscpFrameParser parser;
+		static vector<SRscpValue> values;
+		values.clear();
+		sink += parser.parse(data, length, values);
+		sink += walkRange(tagData, tagLength);
+	});
+	measure(name, "RscpFrameParser 1448 chunks", length, [&]() {
+		static RscpFrameParser parser;
+		static vector<SRscpValue> values;
+		values.clear();
+		int32_t iResult = 0;
+		for (uint32_t received = 0; (received < length) && (iResult == 0);) {
+			received = (length - received > 1448) ? received + 1448 : length;
+			iResult = parser.parse(data, received, values);
+		}
+		sink += iResult;
+		sink += walkRange(tagData, tagLength);
+	});
+	measure(name, "CRC32", length, [&]() {
+		sink += RscpCRC32_Update(0, data, length);
+	});
+}
+
+static void benchmarkBuilders(const BenchFrame & frame) {
+	const char * name = frame.name.c_str();
+	RscpProtocol protocol;
+	measure(name, "build appendValue", frame.data.size(), [&]() {
+		SRscpFrameBuffer frameBuffer;
+		appendHistory(protocol, frameBuffer, frame.intervals);
+		sink += frameBuffer.dataLength;
+		protocol.destroyFrameData(frameBuffer);
+	});
+	vector<uint8_t> buffer;
+	measure(name, "build RscpFrameWriter", frame.data.size(), [&]() {
+		writeHistory(protocol, buffer, frame.intervals);
+		sink += buffer.size();
+	});
+}
+
+static bool readFrame(const char * path, BenchFrame & frame) {
+	FILE * file = fopen(path, "rb");
+	if(file == NULL) {
+		return false;
+	}
+	uint8_t buffer[4096];
+	size_t n;
+	while((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+		frame.data.insert(frame.data.end(), buffer, buffer + n);
+	}
+	fclose(file);
+	// only the first frame of the file
+	RscpProtocol protocol;
+	int32_t frameLength = protocol.getFrameLength(frame.data.data(), frame.data.size());
+	if((frameLength <= 0) || ((uint32_t) frameLength > frame.data.size())) {
+		return false;
+	}
+	frame.data.resize(frameLength);
+	frame.name = "file";
+	frame.intervals = 0;
+	return true;
+}
+
+int main(int argc, char *argv[]) {
+	if(argc > 1) {
+		milliseconds = atoi(argv[1]);
+	}
+	if(milliseconds == 0) {
+		milliseconds = 1;
+	}
+
+	// day in hours, month in days, year in months and as many intervals as fit into a frame
+	static const struct {
+		const char * name;
+		uint32_t intervals;
+	} shapes[] = {{"day", 24}, {"month", 31}, {"year", 12}, {"large", 430}};
+	vector<BenchFrame> frames;
+	RscpProtocol protocol;
+	for (size_t i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++) {
+		BenchFrame frame;
+		frame.name = shapes[i].name;
+		frame.intervals = shapes[i].intervals;
+		writeHistory(protocol, frame.data, frame.intervals);
+		frames.push_back(frame);
+	}
+	for (int i = 2; i < argc; i++) {
+		BenchFrame frame;
+		if(!readFrame(argv[i], frame)) {
+			fprintf(stderr, "%s holds no valid frame\n", argv[i]);
+			return 1;
+		}
+		frames.push_back(frame);
+	}
+
+	// both builders have to create the same tag data, the header differs in the time stamp
+	for (size_t i = 0; i < frames.size(); i++) {
+		if(frames[i].intervals == 0) {
+			continue;
+		}
+		SRscpFrameBuffer frameBuffer;
+		appendHistory(protocol, frameBuffer, frames[i].intervals);
+		const size_t tagLength = reinterpret_cast<const SRscpFrameHeader *>(frames[i].data.data())->dataLength;
+		if((frameBuffer.dataLength != frames[i].data.size())
+				|| (memcmp(frameBuffer.data + sizeof(SRscpFrameHeader), &frames[i].data[sizeof(SRscpFrameHeader)], tagLength) != 0)) {
+			printf("%s: appendValue and RscpFrameWriter frames differ\n", frames[i].name.c_str());
+			return 1;
+		}
+		protocol.destroyFrameData(frameBuffer);
+	}
+
+	for (size_t i = 0; i < frames.size(); i++) {
+		benchmarkParsers(frames[i]);
+		if(frames[i].intervals > 0) {
+			benchmarkBuilders(frames[i]);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,275 @@
+//============================================================================
+// Name        : check_session.cpp
+// Description : Checks of RscpSession without a network. A fake S10 in the
+//             : same process encrypts its responses and hands them to the
+//             : session the way a transport would, so retries after damaged
+//             : frames, frames that are not RSCP and the circuit breaker can
+//             : be driven step by step.
+//             : "make check_session" builds it with ASan and UBSan, run
+//             : "./check_session".
+//============================================================================
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "RscpSession.h"
+#include "RscpFrameWriter.h"
+#include "RscpTags.h"
+
+using namespace std;
+
+#define CHECK(cond) \
+	do { \
+		if(!(cond)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			abort(); \
+		} \
+	} while(0)
+
+#define AES_PASSWORD "secret"
+
+// keeps everything the session hands over
+class RecordHandler : public RscpSessionHandler {
+public:
+	RecordHandler() : retries(0), finishedError(-1) {
+	}
+	void request(RscpSession & session, const SRscpHistoryRequest & request, size_t index, RscpFrameWriter & writer) {
+		requested.push_back(index);
+		RscpSessionHandler::request(session, request, index, writer);
+	}
+	// the values of the reports; the answer to the login comes again with each connection
+	void value(RscpSession & session, const SRscpHistoryRequest * request, const SRscpValue & value) {
+		if(request == NULL) {
+			return;
+		}
+		char head[64];
+		snprintf(head, sizeof(head), "%ld %08X %u:", (long) request->start.seconds, value.tag, value.dataType);
+		values.push_back(string(head) + string((const char *) value.data, value.length));
+	}
+	void retrying(RscpSession & session, int error, uint32_t delayMs) {
+		retries++;
+	}
+	void finished(RscpSession & session, int error) {
+		finishedError = error;
+	}
+	vector<string> values;
+	vector<size_t> requested;
+	int retries;
+	int finishedError;
+};
+
+// the S10 side of one connection
+class FakeS10 {
+public:
+	FakeS10() : chunk(100) {
+	}
+	// a new connection of \var session; a wrong password gives cipher text the session can not decrypt
+	void connect(RscpSession & session, const char * password = AES_PASSWORD) {
+		cipher.init(password);
+		session.connecting();
+		session.connected();
+		drain(session);
+	}
+	// the response to the login
+	void login(RscpSession & session) {
+		vector<uint8_t> buffer;
+		RscpFrameWriter writer(buffer);
+		writer.appendValue(TAG_RSCP_AUTHENTICATION, (uint8_t) 10);
+		send(session, writer, buffer, -1);
+	}
+	// the history response of report \var index with \var count intervals; \var damage changes a byte of the values
+	void history(RscpSession & session, uint32_t index, uint32_t count, int damage = -1) {
+		vector<uint8_t> buffer;
+		RscpFrameWriter writer(buffer);
+		writer.openContainer(TAG_DB_HISTORY_DATA_DAY);
+		for (uint32_t i = 0; i < count; i++) {
+			writer.openContainer(TAG_DB_VALUE_CONTAINER);
+			writer.appendValue(TAG_DB_GRAPH_INDEX, (float) i);
+			writer.appendValue(TAG_DB_DC_POWER, 1000.0f * index + i);
+			writer.appendValue(TAG_DB_CONSUMPTION, 400.0f + i);
+			writer.closeContainer();
+		}
+		writer.closeContainer();
+		send(session, writer, buffer, damage);
+	}
+	// a frame with \var count top level values, so that values are kept while the receive buffer grows
+	void flat(RscpSession & session, uint32_t count) {
+		vector<uint8_t> buffer;
+		RscpFrameWriter writer(buffer);
+		for (uint32_t i = 0; i < count; i++) {
+			writer.appendValue(TAG_EMS_POWER_PV, (int32_t) i);
+		}
+		send(session, writer, buffer, -1);
+	}
+	// the encrypted frames are handed over in pieces of chunk bytes, as they would come from the socket
+	uint32_t chunk;
+
+private:
+	// \var data is the buffer of \var writer
+	void send(RscpSession & session, RscpFrameWriter & writer, vector<uint8_t> & data, int damage) {
+		CHECK(writer.finishFrame(protocol, true, AES_BLOCK_SIZE) == RSCP::OK);
+		if(damage >= 0) {
+			// behind the header, the CRC does not match any more
+			data[sizeof(SRscpFrameHeader) + damage] ^= 0x40;
+		}
+		cipher.encrypt(&data[0], data.size());
+		for (size_t pos = 0; pos < data.size() && session.isActive(); pos += chunk) {
+			uint32_t length = (data.size() - pos < chunk) ? data.size() - pos : chunk;
+			uint32_t space;
+			uint8_t * to = session.getReceiveSpace(space);
+			CHECK(to != NULL && space >= length);
+			memcpy(to, &data[pos], length);
+			session.received(length);
+		}
+		drain(session);
+	}
+	// the requests of the session are encrypted and thrown away
+	void drain(RscpSession & session) {
+		uint32_t length;
+		uint8_t * plain = session.getPlainData(length);
+		if(plain != NULL) {
+			session.getCipher().encrypt(plain, length);
+			session.encrypted();
+		}
+		while(session.getSendData(length) != NULL) {
+			session.sent(length);
+		}
+	}
+	RscpProtocol protocol;
+	RscpCipher cipher;
+};
+
+static vector<SRscpHistoryRequest> makeRequests(uint32_t count) {
+	vector<SRscpHistoryRequest> requests;
+	for (uint32_t i = 0; i < count; i++) {
+		SRscpHistoryRequest request;
+		request.spanTag = TAG_DB_REQ_HISTORY_DATA_DAY;
+		request.start.seconds = 1487289600 + i * 86400;
+		request.start.nanoseconds = 0;
+		request.interval.seconds = 900;
+		request.interval.nanoseconds = 0;
+		request.span.seconds = 86399;
+		request.span.nanoseconds = 0;
+		requests.push_back(request);
+	}
+	return requests;
+}
+
+static RscpSession * makeSession(RecordHandler & handler, uint32_t requests, uint32_t maxRetries) {
+	RscpSession * session = new RscpSession(handler);
+	session->setDevice("127.0.0.1", 5033, "user", "password", AES_PASSWORD);
+	session->setRequests(makeRequests(requests));
+	SRscpRetryPolicy policy = RSCP_RETRY_DEFAULT;
+	policy.maxRetries = maxRetries;
+	session->setRetryPolicy(policy);
+	return session;
+}
+
+// a frame damaged in the middle of the responses: nothing of it is handed over, the connection is
+// retried, only the open reports are requested again and the values equal those of a clean run
+static void checkDamagedFrame(void) {
+	FakeS10 s10;
+	RecordHandler clean;
+	RscpSession * session = makeSession(clean, 3, 3);
+	s10.connect(*session);
+	s10.login(*session);
+	for (uint32_t i = 0; i < 3; i++) {
+		s10.history(*session, i, 96);
+	}
+	CHECK(session->getState() == RscpSession::eStateDone);
+	CHECK(clean.finishedError == 0);
+	delete session;
+
+	RecordHandler handler;
+	session = makeSession(handler, 3, 3);
+	s10.connect(*session);
+	s10.login(*session);
+	s10.history(*session, 0, 96);
+	size_t firstResponse = handler.values.size();
+	s10.history(*session, 1, 96, 500);
+	CHECK(session->getState() == RscpSession::eStateBackoff);
+	CHECK(session->getError() == EBADMSG);
+	CHECK(handler.retries == 1);
+	CHECK(handler.values.size() == firstResponse);
+
+	handler.requested.clear();
+	s10.connect(*session);
+	s10.login(*session);
+	CHECK(handler.requested.size() == 2 && handler.requested[0] == 1 && handler.requested[1] == 2);
+	s10.history(*session, 1, 96);
+	s10.history(*session, 2, 96);
+	CHECK(session->getState() == RscpSession::eStateDone);
+	CHECK(handler.finishedError == 0);
+	CHECK(handler.values == clean.values);
+	delete session;
+}
+
+// an answer that is not RSCP before the login is answered is not retried
+static void checkNotRscp(void) {
+	FakeS10 s10;
+	RecordHandler handler;
+	RscpSession * session = makeSession(handler, 1, 3);
+	s10.connect(*session, "wrong");
+	s10.login(*session);
+	CHECK(session->getState() == RscpSession::eStateFailed);
+	CHECK(handler.finishedError == EPROTO);
+	CHECK(handler.retries == 0);
+	CHECK(handler.values.empty());
+	delete session;
+}
+
+// with the default policy a S10 that fails every time opens the circuit before it is given up
+static void checkBreaker(void) {
+	FakeS10 s10;
+	RecordHandler handler;
+	SRscpRetryPolicy policy = RSCP_RETRY_DEFAULT;
+	RscpSession * session = makeSession(handler, 1, policy.maxRetries);
+	bool opened = false;
+	while(session->getState() != RscpSession::eStateFailed) {
+		s10.connect(*session);
+		session->fail(ECONNREFUSED);
+		if(session->getBreakerState() == RscpCircuitBreaker::eStateOpen) {
+			if(session->getState() == RscpSession::eStateBackoff) {
+				// the pause of the open circuit, not the backoff, up to 50% longer for the jitter
+				CHECK(session->getRetryDelay() > policy.breakerWindowMs - 1000);
+				CHECK(session->getRetryDelay() <= policy.breakerWindowMs + policy.breakerWindowMs / 2);
+			}
+			opened = true;
+		}
+	}
+	CHECK(opened);
+	CHECK(handler.retries == (int) policy.maxRetries);
+	CHECK(handler.finishedError == ECONNREFUSED);
+	delete session;
+}
+
+// values of a frame that are kept while the receive buffer grows for the frame stay valid
+static void checkGrowingBuffer(void) {
+	FakeS10 s10;
+	RecordHandler handler;
+	RscpSession * session = makeSession(handler, 1, 0);
+	s10.connect(*session);
+	s10.login(*session);
+	s10.chunk = 64;
+	s10.flat(*session, 3000);
+	CHECK(handler.values.size() == 3000);
+	for (uint32_t i = 0; i < 3000; i++) {
+		int32_t value;
+		memcpy(&value, handler.values[i].data() + handler.values[i].size() - sizeof(value), sizeof(value));
+		CHECK(value == (int32_t) i);
+	}
+	delete session;
+}
+
+int main(int argc, char *argv[]) {
+	checkDamagedFrame();
+	checkNotRscp();
+	checkBreaker();
+	checkGrowingBuffer();
+	printf("RscpSession: ok\n");
+	return 0;
+}
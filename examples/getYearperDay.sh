@@ -59,19 +59,10 @@ if ! $PROG -u $USER -P $PW_USER -A $AES_SECRET -i $IP   -y $1; then
 	exit 1
 fi
  
-i=1
-while [ $i -le 366 ]; do 
-	#echo "$i" 
-	j=4
-	while ! $PROG -u $USER -P $PW_USER -A $AES_SECRET -i $IP   -y $1 -m 1 -b -d $i ; do
-		errecho "WARNING: retrying connection"
-		sleep 10
-		let j=$j-1
-		if [ $j -le 0 ]; then
-			errecho "ERROR: to many connection failiures"
-			exit 1
-		fi
-	done
-	let i=$i+1 
-done
-
+# all days of the year over one connection; after a connection failure the program
+# reconnects itself and requests only the days not received yet
+days=$(date -d "$1-12-31" +%j)
+if ! $PROG -u $USER -P $PW_USER -A $AES_SECRET -i $IP   -y $1 -m 1 -d 1 -b -c $days -R 3 -B 10000 ; then
+	errecho "ERROR: to many connection failiures"
+	exit 1
+fi
@@ -61,19 +61,9 @@ if ! $PROG -u $USER -P $PW_USER -A $AES_SECRET -i $IP   -y $1; then
 	exit 1
 fi
  
-i=1
-while [ $i -le 12 ]; do 
-	#echo "$i" 
-	j=2
-	while ! $PROG -u $USER -P $PW_USER -A $AES_SECRET -i $IP   -y $1 -m $i -b ; do
-		errecho "WARNING: connection failed; retry"
-		sleep 20
-		let j=$j-1
-		if [ $j -le 0 ]; then
-			errecho "ERROR: too many retries; giving up"
-			exit 1
-		fi
-	done
-	let i=$i+1 
-done
-
+# all months of the year over one connection; after a connection failure the program
+# reconnects itself and requests only the months not received yet
+if ! $PROG -u $USER -P $PW_USER -A $AES_SECRET -i $IP   -y $1 -m 1 -b -c 12 -R 1 -B 20000 ; then
+	errecho "ERROR: too many retries; giving up"
+	exit 1
+fi
@@ -0,0 +1,408 @@
+//============================================================================
+// Name        : fuzz_rscp.cpp
+// Description : Fuzz target for the RSCP parsers. Every parser gets the same
+//             : input in a buffer of exactly its size, so a read behind the
+//             : input is found by the address sanitizer, and the results of
+//             : the parsers are checked against each other, as are the
+//             : CRC32 implementations.
+//             : "make fuzz_rscp" builds a standalone binary with ASan and
+//             : UBSan that mutates built in history frames or runs the
+//             : given files: "./fuzz_rscp [-runs=N] [file ...]".
+//             : With clang "make fuzz_rscp_libfuzzer" builds the same
+//             : target for libFuzzer (RSCP_LIBFUZZER, no main()).
+//============================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include "RscpProtocol.h"
+#include "RscpArena.h"
+#include "RscpContainer.h"
+#include "RscpCRC32.h"
+#include "RscpFrameParser.h"
+#include "RscpFrameWriter.h"
+#include "RscpHistory.h"
+#include "RscpTags.h"
+
+using namespace std;
+
+#define CHECK(cond) \
+	do { \
+		if(!(cond)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			abort(); \
+		} \
+	} while(0)
+
+// size of a value without its data (tag, data type and length)
+#define VALUE_HEADER_SIZE   (sizeof(SRscpValue) - sizeof(((SRscpValue *) 0)->data))
+
+static const uint8_t * inputBegin;
+static const uint8_t * inputEnd;
+
+// a zero copy value has to lie completely inside the input
+static void checkInInput(const SRscpValue & value) {
+	if(value.length == 0) {
+		CHECK(value.data == NULL);
+		return;
+	}
+	CHECK(value.data >= inputBegin);
+	CHECK(value.data + value.length <= inputEnd);
+}
+
+static bool sameValue(const SRscpValue & a, const SRscpValue & b) {
+	return (a.tag == b.tag) && (a.dataType == b.dataType) && (a.length == b.length) && (a.data == b.data);
+}
+
+// counts what visitData() passes and checks that it stays inside the input
+class CheckVisitor : public RscpVisitor {
+public:
+	CheckVisitor() : depth(0), topLevel(0) {
+	}
+	bool enterContainer(const SRscpValue & container) {
+		checkInInput(container);
+		if(depth == 0) {
+			topLevel++;
+		}
+		depth++;
+		return true;
+	}
+	void value(const SRscpValue & value) {
+		checkInInput(value);
+		if(depth == 0) {
+			topLevel++;
+		}
+	}
+	void leaveContainer(const SRscpValue & container) {
+		CHECK(depth > 0);
+		depth--;
+	}
+	uint32_t depth;
+	uint32_t topLevel;
+};
+
+// RscpContainerRange has to return the same values as parseData(), also inside the containers
+static void checkContainers(RscpProtocol & protocol, const uint8_t * data, uint32_t length, int level) {
+	vector<SRscpValue> values;
+	protocol.parseData(data, length, values, false);
+	size_t i = 0;
+	for (const SRscpValue & value : RscpContainerRange(data, length)) {
+		CHECK(i < values.size());
+		CHECK(sameValue(value, values[i]));
+		checkInInput(value);
+		if((value.dataType == RSCP::eTypeContainer) && (value.length > 0) && (level < RSCP_MAX_VISIT_DEPTH)) {
+			checkContainers(protocol, value.data, value.length, level + 1);
+		}
+		i++;
+	}
+	CHECK(i == values.size());
+}
+
+// the frame data written again with RscpFrameWriter has to give the same bytes
+static void checkRewrite(RscpProtocol & protocol, const uint8_t * data, const vector<SRscpValue> & values, int32_t parsed) {
+	if(parsed > 0xFFF8) {
+		return;
+	}
+	vector<uint8_t> buffer;
+	RscpFrameWriter writer(buffer);
+	for (size_t i = 0; i < values.size(); i++) {
+		CHECK(writer.appendValue(values[i].tag, values[i].data, values[i].length, values[i].dataType) == RSCP::OK);
+	}
+	CHECK(writer.getDataLength() == parsed);
+	CHECK(writer.finishFrame(protocol, true, 1) == RSCP::OK);
+	CHECK(memcmp(&buffer[sizeof(SRscpFrameHeader)], data, parsed) == 0);
+}
+
+// feed the input to RscpFrameParser in pieces of different sizes, as they would arrive from the socket
+static void checkFrameParser(const uint8_t * data, uint32_t length, int32_t frameResult, const vector<SRscpValue> & frameValues) {
+	static const uint32_t chunkSizes[] = {1, 7, 64, 1448};
+	for (size_t c = 0; c < sizeof(chunkSizes) / sizeof(chunkSizes[0]); c++) {
+		RscpFrameParser parser;
+		vector<SRscpValue> values;
+		int32_t iResult = 0;
+		uint32_t received = 0;
+		while(received < length) {
+			received += (length - received < chunkSizes[c]) ? (length - received) : chunkSizes[c];
+			iResult = parser.parse(data, received, values);
+			for (size_t i = 0; i < values.size(); i++) {
+				checkInInput(values[i]);
+				CHECK(values[i].data == NULL || values[i].data + values[i].length <= data + received);
+			}
+			if(iResult != 0) {
+				break;
+			}
+		}
+		if(frameResult == RSCP::ERR_INVALID_CRC) {
+			CHECK(iResult == RSCP::ERR_INVALID_CRC);
+		}
+		if(frameResult > 0) {
+			// the parser returns the whole frame, parseFrame() only what it parsed
+			CHECK(iResult > 0);
+			CHECK(iResult >= frameResult);
+			CHECK(values.size() == frameValues.size());
+			for (size_t i = 0; i < values.size(); i++) {
+				CHECK(sameValue(values[i], frameValues[i]));
+			}
+		}
+	}
+}
+
+// all CRC32 implementations have to give the same CRC, at every alignment and split into two updates
+static void checkCRC32(const uint8_t * data, uint32_t length) {
+	bool pclmul = RscpCRC32_PCLMULSupported();
+	for (uint32_t offset = 0; (offset < 8) && (offset <= length); offset++) {
+		const uint8_t * p = data + offset;
+		uint32_t n = length - offset;
+		uint32_t crc = RscpCRC32_UpdateNibble(0, p, n);
+		CHECK(RscpCRC32_UpdateSlice8(0, p, n) == crc);
+		CHECK(!pclmul || (RscpCRC32_UpdatePCLMUL(0, p, n) == crc));
+		CHECK(RscpCRC32_Update(0, p, n) == crc);
+		uint32_t split = (n > 0) ? (crc ^ offset) % (n + 1) : 0;
+		CHECK(RscpCRC32_Update(RscpCRC32_Update(0, p, split), p + split, n - split) == crc);
+		CHECK(RscpCRC32_UpdateNibble(RscpCRC32_UpdateNibble(0, p, split), p + split, n - split) == crc);
+	}
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t * fuzzData, size_t fuzzSize) {
+	if(fuzzSize > 0x20000) {
+		return 0;
+	}
+	// exact size copy, the sanitizer finds every read behind the input
+	uint32_t length = fuzzSize;
+	uint8_t * data = (uint8_t *) malloc((length > 0) ? length : 1);
+	memcpy(data, fuzzData, length);
+	inputBegin = data;
+	inputEnd = data + length;
+
+	RscpProtocol protocol;
+	int32_t frameLength = protocol.getFrameLength(data, length);
+
+	// zero copy frame
+	SRscpFrame frame;
+	int32_t frameResult = protocol.parseFrame(data, length, &frame, false);
+	if(frameResult > 0) {
+		CHECK(frameLength > 0);
+		CHECK(frameResult <= frameLength);
+		CHECK((uint32_t) frameLength <= length);
+		for (size_t i = 0; i < frame.data.size(); i++) {
+			checkInInput(frame.data[i]);
+		}
+	}
+
+	// copied frame, the data has to equal the zero copy data
+	SRscpFrame copied;
+	if(protocol.parseFrame(data, length, &copied, true) > 0) {
+		CHECK(copied.data.size() == frame.data.size());
+		for (size_t i = 0; i < copied.data.size(); i++) {
+			CHECK(copied.data[i].length == frame.data[i].length);
+			CHECK(copied.data[i].length == 0 || memcmp(copied.data[i].data, frame.data[i].data, copied.data[i].length) == 0);
+		}
+		protocol.destroyFrameData(copied);
+	}
+
+	// the whole input as tag data
+	vector<SRscpValue> values;
+	int32_t parsed = protocol.parseData(data, length, values, false);
+	CHECK(parsed >= 0 && (uint32_t) parsed <= length);
+	uint32_t sum = 0;
+	for (size_t i = 0; i < values.size(); i++) {
+		checkInInput(values[i]);
+		sum += VALUE_HEADER_SIZE + values[i].length;
+	}
+	CHECK(sum == (uint32_t) parsed);
+
+	// the same from an arena
+	RscpArena arena(4096);
+	RscpProtocol arenaProtocol(&arena);
+	vector<SRscpValue> arenaValues;
+	CHECK(arenaProtocol.parseData(data, length, arenaValues, true) == parsed);
+	CHECK(arenaValues.size() == values.size());
+	for (size_t i = 0; i < arenaValues.size(); i++) {
+		CHECK(arenaValues[i].length == 0 || arena.owns(arenaValues[i].data));
+		CHECK(arenaValues[i].length == 0 || memcmp(arenaValues[i].data, values[i].data, values[i].length) == 0);
+	}
+	arenaProtocol.destroyValueData(arenaValues);
+	arena.reset();
+
+	// the visitor walks the same top level values and leaves every container
+	CheckVisitor visitor;
+	int32_t visited = protocol.visitData(data, length, visitor);
+	if(visited >= 0) {
+		CHECK(visited == parsed);
+		CHECK(visitor.depth == 0);
+		CHECK(visitor.topLevel == values.size());
+	}
+	else {
+		CHECK(visited == RSCP::ERR_DATA_LIMIT_EXCEEDED);
+	}
+
+	// the whole input as a history response, every column has a value or NaN for every interval
+	SRscpValue response;
+	response.tag = TAG_DB_HISTORY_DATA_DAY;
+	response.dataType = RSCP::eTypeContainer;
+	response.length = (length < 0xFFFF) ? length : 0xFFFF;
+	response.data = (length > 0) ? data : NULL;
+	RscpHistory history;
+	int32_t intervals = history.decode(&response, 0, 900);
+	CHECK(intervals >= 0 && (size_t) intervals == history.size());
+	for (int c = 0; c < eHistoryColumnCount; c++) {
+		const float * column = history.getColumn((eRscpHistoryColumn) c);
+		for (int32_t i = 0; i < intervals; i++) {
+			CHECK(column[i] == column[i] || isnan(column[i]));
+		}
+	}
+
+	checkContainers(protocol, data, length, 0);
+	checkCRC32(data, length);
+	checkRewrite(protocol, data, values, parsed);
+	if(frameLength > 0) {
+		checkFrameParser(data, length, frameResult, frame.data);
+	}
+
+	free(data);
+	return 0;
+}
+
+#ifndef RSCP_LIBFUZZER
+
+static uint32_t randomState = 0x12345678;
+static uint32_t random32(void) {
+	// xorshift, the same runs on every start
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return randomState;
+}
+
+// history response like the S10 sends it, with \var count value containers
+static vector<uint8_t> historyFrame(uint32_t count, bool calcCRC) {
+	RscpProtocol protocol;
+	vector<uint8_t> buffer;
+	RscpFrameWriter writer(buffer);
+	writer.openContainer(TAG_DB_HISTORY_DATA_DAY);
+	for (uint32_t i = 0; i <= count; i++) {
+		writer.openContainer((i < count) ? TAG_DB_VALUE_CONTAINER : TAG_DB_SUM_CONTAINER);
+		writer.appendValue(TAG_DB_GRAPH_INDEX, (float) i);
+		writer.appendValue(TAG_DB_BAT_POWER_IN, 100.0f * i);
+		writer.appendValue(TAG_DB_BAT_POWER_OUT, 50.0f * i);
+		writer.appendValue(TAG_DB_DC_POWER, 1000.0f + i);
+		writer.appendValue(TAG_DB_GRID_POWER_IN, 10.0f * i);
+		writer.appendValue(TAG_DB_GRID_POWER_OUT, 20.0f * i);
+		writer.appendValue(TAG_DB_CONSUMPTION, 400.0f + i);
+		writer.appendValue(TAG_DB_BAT_CHARGE_LEVEL, 0.5f);
+		writer.appendValue(TAG_DB_AUTARKY, 0.9f);
+		writer.closeContainer();
+	}
+	writer.closeContainer();
+	writer.appendValue(TAG_EMS_POWER_PV, (int32_t) 4711);
+	writer.appendValue(TAG_RSCP_AUTHENTICATION_USER, "user");
+	writer.finishFrame(protocol, calcCRC, 1);
+	return buffer;
+}
+
+// a string longer than the 16 bit value length is rejected, not cut
+static void checkStringLimit(void) {
+	vector<uint8_t> buffer;
+	RscpFrameWriter writer(buffer);
+	string text(0x10000, 'x');
+	CHECK(writer.appendValue(TAG_RSCP_AUTHENTICATION_USER, text) == RSCP::ERR_DATA_LIMIT_EXCEEDED);
+	CHECK(writer.appendValue(TAG_RSCP_AUTHENTICATION_USER, text.c_str()) == RSCP::ERR_DATA_LIMIT_EXCEEDED);
+	CHECK(writer.getDataLength() == 0);
+	text.resize(0xFFF8 - VALUE_HEADER_SIZE);
+	CHECK(writer.appendValue(TAG_RSCP_AUTHENTICATION_USER, text) == RSCP::OK);
+	CHECK(writer.appendValue(TAG_RSCP_AUTHENTICATION_USER, "") == RSCP::ERR_DATA_LIMIT_EXCEEDED);
+}
+
+static void mutate(vector<uint8_t> & input) {
+	uint32_t mutations = 1 + random32() % 4;
+	for (uint32_t m = 0; m < mutations; m++) {
+		if(input.empty()) {
+			input.push_back(random32());
+			continue;
+		}
+		size_t pos = random32() % input.size();
+		switch(random32() % 6) {
+		case 0:
+			input[pos] ^= 1 << (random32() % 8);
+			break;
+		case 1:
+			input[pos] = random32();
+			break;
+		case 2: {
+			// the length fields are what the parsers trust
+			static const uint8_t interesting[] = {0x00, 0x01, 0x7F, 0x80, 0xFE, 0xFF};
+			input[pos] = interesting[random32() % sizeof(interesting)];
+			break;
+		}
+		case 3:
+			input.resize(pos);
+			break;
+		case 4:
+			input.erase(input.begin() + pos, input.begin() + pos + random32() % (input.size() - pos));
+			break;
+		case 5: {
+			size_t length = random32() % (input.size() - pos);
+			vector<uint8_t> copy(input.begin() + pos, input.begin() + pos + length);
+			input.insert(input.begin() + random32() % input.size(), copy.begin(), copy.end());
+			break;
+		}
+		}
+	}
+}
+
+static bool readFile(const char * path, vector<uint8_t> & input) {
+	FILE * file = fopen(path, "rb");
+	if(file == NULL) {
+		return false;
+	}
+	uint8_t buffer[4096];
+	size_t n;
+	input.clear();
+	while((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+		input.insert(input.end(), buffer, buffer + n);
+	}
+	fclose(file);
+	return true;
+}
+
+int main(int argc, char *argv[]) {
+	uint32_t runs = 100000;
+	vector<vector<uint8_t> > seeds;
+	checkStringLimit();
+	for (int i = 1; i < argc; i++) {
+		if(strncmp(argv[i], "-runs=", 6) == 0) {
+			runs = atoi(argv[i] + 6);
+			continue;
+		}
+		vector<uint8_t> input;
+		if(!readFile(argv[i], input)) {
+			fprintf(stderr, "cannot read %s\n", argv[i]);
+			return 1;
+		}
+		LLVMFuzzerTestOneInput(input.data(), input.size());
+		seeds.push_back(input);
+	}
+	if(seeds.empty()) {
+		// day, month and year history frames with and without CRC
+		static const uint32_t counts[] = {0, 24, 31, 12, 96};
+		for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+			seeds.push_back(historyFrame(counts[i], true));
+			seeds.push_back(historyFrame(counts[i], false));
+		}
+		for (size_t i = 0; i < seeds.size(); i++) {
+			LLVMFuzzerTestOneInput(seeds[i].data(), seeds[i].size());
+		}
+	}
+	for (uint32_t run = 0; run < runs; run++) {
+		vector<uint8_t> input = seeds[random32() % seeds.size()];
+		mutate(input);
+		LLVMFuzzerTestOneInput(input.data(), input.size());
+	}
+	printf("%zu inputs and %u mutations: ok\n", seeds.size(), runs);
+	return 0;
+}
+
+#endif /* RSCP_LIBFUZZER */
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+#============================================================================
+# Name        : gen_tag_schema.py
+# Description : Generates RscpTagSchema.h from RscpTags.h: name, namespace
+#             : and data type of every tag plus a perfect hash from the tag
+#             : to its entry. Run "make tag_schema" after RscpTags.h changed.
+#============================================================================
+
+import re
+import sys
+
+# RscpTags.h has no type information, these are the types of the tags this
+# program sends or decodes. All other tags get RSCP_TYPE_UNKNOWN.
+KNOWN_TYPES = {
+    'TAG_RSCP_REQ_AUTHENTICATION': 'eTypeContainer',
+    'TAG_RSCP_AUTHENTICATION_USER': 'eTypeString',
+    'TAG_RSCP_AUTHENTICATION_PASSWORD': 'eTypeString',
+    'TAG_RSCP_AUTHENTICATION': 'eTypeUChar8',
+    'TAG_RSCP_GENERAL_ERROR': 'eTypeError',
+    'TAG_EMS_REQ_POWER_PV': 'eTypeNone',
+    'TAG_EMS_REQ_POWER_BAT': 'eTypeNone',
+    'TAG_EMS_REQ_POWER_HOME': 'eTypeNone',
+    'TAG_EMS_REQ_POWER_GRID': 'eTypeNone',
+    'TAG_EMS_REQ_POWER_ADD': 'eTypeNone',
+    'TAG_EMS_POWER_PV': 'eTypeInt32',
+    'TAG_EMS_POWER_BAT': 'eTypeInt32',
+    'TAG_EMS_POWER_HOME': 'eTypeInt32',
+    'TAG_EMS_POWER_GRID': 'eTypeInt32',
+    'TAG_EMS_POWER_ADD': 'eTypeInt32',
+    'TAG_BAT_REQ_DATA': 'eTypeContainer',
+    'TAG_BAT_DATA': 'eTypeContainer',
+    'TAG_BAT_INDEX': 'eTypeUChar8',
+    'TAG_BAT_REQ_RSOC': 'eTypeNone',
+    'TAG_BAT_REQ_MODULE_VOLTAGE': 'eTypeNone',
+    'TAG_BAT_REQ_CURRENT': 'eTypeNone',
+    'TAG_BAT_REQ_STATUS_CODE': 'eTypeNone',
+    'TAG_BAT_REQ_ERROR_CODE': 'eTypeNone',
+    'TAG_BAT_RSOC': 'eTypeFloat32',
+    'TAG_BAT_MODULE_VOLTAGE': 'eTypeFloat32',
+    'TAG_BAT_CURRENT': 'eTypeFloat32',
+    'TAG_BAT_STATUS_CODE': 'eTypeUInt32',
+    'TAG_BAT_ERROR_CODE': 'eTypeUInt32',
+    'TAG_DB_REQ_HISTORY_DATA_DAY': 'eTypeContainer',
+    'TAG_DB_REQ_HISTORY_DATA_MONTH': 'eTypeContainer',
+    'TAG_DB_REQ_HISTORY_DATA_YEAR': 'eTypeContainer',
+    'TAG_DB_REQ_HISTORY_TIME_START': 'eTypeTimestamp',
+    'TAG_DB_REQ_HISTORY_TIME_INTERVAL': 'eTypeTimestamp',
+    'TAG_DB_REQ_HISTORY_TIME_SPAN': 'eTypeTimestamp',
+    'TAG_DB_HISTORY_DATA_DAY': 'eTypeContainer',
+    'TAG_DB_HISTORY_DATA_MONTH': 'eTypeContainer',
+    'TAG_DB_HISTORY_DATA_YEAR': 'eTypeContainer',
+    'TAG_DB_SUM_CONTAINER': 'eTypeContainer',
+    'TAG_DB_VALUE_CONTAINER': 'eTypeContainer',
+    'TAG_DB_GRAPH_INDEX': 'eTypeFloat32',
+    'TAG_DB_BAT_POWER_IN': 'eTypeFloat32',
+    'TAG_DB_BAT_POWER_OUT': 'eTypeFloat32',
+    'TAG_DB_DC_POWER': 'eTypeFloat32',
+    'TAG_DB_GRID_POWER_IN': 'eTypeFloat32',
+    'TAG_DB_GRID_POWER_OUT': 'eTypeFloat32',
+    'TAG_DB_CONSUMPTION': 'eTypeFloat32',
+    'TAG_DB_PM_0_POWER': 'eTypeFloat32',
+    'TAG_DB_PM_1_POWER': 'eTypeFloat32',
+    'TAG_DB_BAT_CHARGE_LEVEL': 'eTypeFloat32',
+    'TAG_DB_BAT_CYCLE_COUNT': 'eTypeFloat32',
+    'TAG_DB_CONSUMED_PRODUCTION': 'eTypeFloat32',
+    'TAG_DB_AUTARKY': 'eTypeFloat32',
+}
+
+# perfect hash: bucket = (tag * MUL1) >> 24, slot = (((tag * MUL2) >> 22) ^ displacement[bucket]) & 1023
+BUCKETS = 256
+SLOTS = 1024
+MULTIPLIERS = [(0x9E3779B1, 0x85EBCA77), (0xC2B2AE3D, 0x27D4EB2F), (0x165667B1, 0xD3A2646C | 1)]
+
+
+def hash_bucket(tag, mul):
+    return ((tag * mul) & 0xFFFFFFFF) >> 24
+
+
+def hash_slot(tag, mul):
+    return ((tag * mul) & 0xFFFFFFFF) >> 22
+
+
+def perfect_hash(tags):
+    for mul1, mul2 in MULTIPLIERS:
+        buckets = [[] for _ in range(BUCKETS)]
+        for index, tag in enumerate(tags):
+            buckets[hash_bucket(tag, mul1)].append(index)
+        slots = [0] * SLOTS
+        displacement = [0] * BUCKETS
+        ok = True
+        # the biggest buckets first, they are the hardest to place
+        for b in sorted(range(BUCKETS), key=lambda b: -len(buckets[b])):
+            if not buckets[b]:
+                continue
+            for d in range(SLOTS):
+                wanted = [(hash_slot(tags[i], mul2) ^ d) & (SLOTS - 1) for i in buckets[b]]
+                if len(set(wanted)) == len(wanted) and all(slots[s] == 0 for s in wanted):
+                    for i, s in zip(buckets[b], wanted):
+                        slots[s] = i + 1
+                    displacement[b] = d
+                    break
+            else:
+                ok = False
+                break
+        if ok:
+            return mul1, mul2, displacement, slots
+    sys.exit('no perfect hash found, add multipliers')
+
+
+def table(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('\t' + ', '.join(fmt % v for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    source = sys.argv[1] if len(sys.argv) > 1 else 'RscpTags.h'
+    target = sys.argv[2] if len(sys.argv) > 2 else 'RscpTagSchema.h'
+    entries = []
+    for line in open(source):
+        m = re.match(r'#define\s+(TAG_\w+)\s+(0x[0-9A-Fa-f]+)', line)
+        if m:
+            entries.append((int(m.group(2), 16), m.group(1)))
+    unknown = set(KNOWN_TYPES) - set(name for _, name in entries)
+    if unknown:
+        sys.exit('KNOWN_TYPES has tags that are not in %s: %s' % (source, ', '.join(sorted(unknown))))
+    entries.sort()
+    tags = [tag for tag, _ in entries]
+    if len(set(tags)) != len(tags):
+        sys.exit('duplicate tag values in %s' % source)
+
+    # the namespace is the most significant byte, its name the first part of the tag names
+    nameSpaces = {}
+    for tag, name in entries:
+        nameSpaces.setdefault(tag >> 24, name.split('_')[1])
+
+    mul1, mul2, displacement, slots = perfect_hash(tags)
+
+    out = []
+    out.append('''//============================================================================
+// Name        : RscpTagSchema.h
+// Description : Name, namespace and data type of the RSCP tags.
+//             : Generated by gen_tag_schema.py from %s - do not edit.
+//============================================================================
+
+#ifndef RSCPTAGSCHEMA_H_
+#define RSCPTAGSCHEMA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "RscpTypes.h"
+#include "RscpTags.h"
+
+// data type of the tags whose type is not known
+#define RSCP_TYPE_UNKNOWN           0xFE
+
+struct SRscpTagInfo {
+	SRscpTag tag;
+	uint8_t dataType;
+	const char * name;
+};
+
+namespace RscpTagSchema {
+
+// all tags, sorted by tag
+constexpr SRscpTagInfo tags[] = {''' % source)
+    for tag, name in entries:
+        dataType = ('RSCP::' + KNOWN_TYPES[name]) if name in KNOWN_TYPES else 'RSCP_TYPE_UNKNOWN'
+        out.append('\t{ %s, %s, "%s" },' % (name, dataType, name))
+    out.append('''};
+
+constexpr uint32_t tagCount = sizeof(tags) / sizeof(tags[0]);
+
+// names of the namespaces (most significant byte of the tag)
+constexpr const char * nameSpaces[] = {''')
+    last = max(nameSpaces)
+    for ns in range(last + 1):
+        out.append('\t%s,' % (('"%s"' % nameSpaces[ns]) if ns in nameSpaces else 'NULL'))
+    out.append('''};
+
+// perfect hash of the tags, slots holds the index into tags + 1 (0 = empty)
+constexpr uint32_t hashMul1 = 0x%08X;
+constexpr uint32_t hashMul2 = 0x%08X;
+constexpr uint16_t displacement[%d] = {
+%s
+};
+constexpr uint16_t slots[%d] = {
+%s
+};
+''' % (mul1, mul2, BUCKETS, table(displacement, 16, '%d'), SLOTS, table(slots, 16, '%d')))
+    out.append('''// slot of \\var tag in slots
+constexpr uint32_t slot(SRscpTag tag) {
+	return (((uint32_t) (tag * hashMul2) >> 22) ^ displacement[(uint32_t) (tag * hashMul1) >> 24]) & %d;
+}
+
+/*
+ * \\brief Entry of \\var tag or NULL if the tag is not known. Two multiplications and two table reads.
+ */
+constexpr const SRscpTagInfo * find(SRscpTag tag) {
+	uint16_t index = slots[slot(tag)];
+	return ((index != 0) && (tags[index - 1].tag == tag)) ? &tags[index - 1] : NULL;
+}
+
+/*
+ * \\brief Name of \\var tag (e.g. "TAG_EMS_POWER_PV") or NULL if the tag is not known.
+ */
+constexpr const char * name(SRscpTag tag) {
+	return (find(tag) != NULL) ? find(tag)->name : NULL;
+}
+
+/*
+ * \\brief Expected RSCP::eRscpDataType of \\var tag or RSCP_TYPE_UNKNOWN.
+ */
+constexpr uint8_t dataType(SRscpTag tag) {
+	return (find(tag) != NULL) ? find(tag)->dataType : RSCP_TYPE_UNKNOWN;
+}
+
+/*
+ * \\brief Namespace of \\var tag (e.g. 0x01) and its name (e.g. "EMS" or NULL if not known).
+ */
+constexpr uint8_t nameSpace(SRscpTag tag) {
+	return tag >> 24;
+}
+constexpr const char * nameSpaceName(SRscpTag tag) {
+	return (nameSpace(tag) < sizeof(nameSpaces) / sizeof(nameSpaces[0])) ? nameSpaces[nameSpace(tag)] : NULL;
+}
+
+} // namespace RscpTagSchema
+
+#endif /* RSCPTAGSCHEMA_H_ */''' % (SLOTS - 1))
+    with open(target, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()